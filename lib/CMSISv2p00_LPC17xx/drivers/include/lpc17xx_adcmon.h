@@ -0,0 +1,124 @@
+/**********************************************************************
+ * $Id$		lpc17xx_adcmon.h				2026-10-18
+ *//**
+* @file		lpc17xx_adcmon.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the ADC window monitor (analog watchdog) on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup ADCMON ADCMON (ADC Window Monitor)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * @{
+ */
+
+#ifndef LPC17XX_ADCMON_H_
+#define LPC17XX_ADCMON_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup ADCMON_Public_Macros ADCMON Public Macros
+ * @{
+ */
+
+/** Number of ADC channels that can be monitored */
+#define ADCMON_NUM_CHANNELS (8)
+
+/** Full scale value of a 12 bit ADC result */
+#define ADCMON_FULL_SCALE (0xFFF)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup ADCMON_Private_Macros ADCMON Private Macros
+ * @{
+ */
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check ADC channel */
+#define PARAM_ADCMON_CHANNEL(n) ((n) < ADCMON_NUM_CHANNELS)
+
+/** Macro to check window thresholds (counts) */
+#define PARAM_ADCMON_WINDOW(low, high, hyst)                                                                         \
+    (((low) < (high)) && ((high) <= ADCMON_FULL_SCALE) && ((uint32_t)(low) + (hyst) < (high)))
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup ADCMON_Public_Types ADCMON Public Types
+     * @{
+     */
+
+    /**
+     * @brief Zone of a monitored channel relative to its window
+     */
+    typedef enum
+    {
+        ADCMON_ZONE_UNKNOWN = 0, /**< No sample evaluated yet */
+        ADCMON_ZONE_LOW,         /**< Value at or below the low threshold */
+        ADCMON_ZONE_NORMAL,      /**< Value inside the window */
+        ADCMON_ZONE_HIGH         /**< Value at or above the high threshold */
+    } ADCMON_ZONE_Type;
+
+    /** Transition callback, called from the context that feeds the samples */
+    typedef void (*ADCMON_Callback_Type)(uint8_t channel, ADCMON_ZONE_Type zone, uint16_t value);
+
+    /**
+     * @brief Window configuration structure, all values in ADC counts (0..4095)
+     */
+    typedef struct
+    {
+        uint16_t LowThreshold;         /**< Entering LOW when value <= LowThreshold */
+        uint16_t HighThreshold;        /**< Entering HIGH when value >= HighThreshold */
+        uint16_t Hysteresis;           /**< Counts a value must move back into the
+                                            window before leaving LOW or HIGH */
+        ADCMON_Callback_Type Callback; /**< Called on every zone change, may be NULL */
+    } ADCMON_CFG_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup ADCMON_Public_Functions ADCMON Public Functions
+     * @{
+     */
+
+    void ADCMON_Init(void);
+    void ADCMON_ChannelConfig(uint8_t channel, const ADCMON_CFG_Type* ADCMONConfigStruct);
+    void ADCMON_ChannelCmd(uint8_t channel, FunctionalState NewState);
+    ADCMON_ZONE_Type ADCMON_GetZone(uint8_t channel);
+
+    /* Sample feeding functions, to be called from ADC or DMA-complete handlers */
+    void ADCMON_Process(uint8_t channel, uint16_t value);
+    void ADCMON_ProcessBuffer(const uint32_t* buffer, uint32_t length);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_ADCMON_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
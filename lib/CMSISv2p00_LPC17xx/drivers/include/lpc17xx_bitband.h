@@ -0,0 +1,154 @@
+/**********************************************************************
+ * $Id$		lpc17xx_bitband.h				2026-10-18
+ *//**
+* @file		lpc17xx_bitband.h
+* @brief	Header-only bit-band access to peripheral flags and GPIO pins
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Library group ----------------------------------------------------------- */
+/** @defgroup BITBAND BITBAND (Bit-band Flag and Pin Access)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * The Cortex-M3 maps every bit of the first megabyte of the SRAM region
+ * (0x20000000, which holds the AHB SRAM banks and the GPIO ports) and of
+ * the peripheral region (0x40000000, the APB0 and APB1 peripherals) to one
+ * word of an alias region:
+ *
+ *   alias = region base + 0x02000000 + byte offset * 32 + bit * 4
+ *
+ * A store to the alias word writes a single bit, done by the bus as one
+ * locked read-modify-write, so no interrupt can slip in between as it can
+ * with REG |= BIT. All macros take a register lvalue and a constant bit
+ * number; with constant operands the alias address folds into a single
+ * literal, so a flag update is one store instruction.
+ *
+ * The locked read-modify-write still writes back the other bits of the
+ * register as read: write-1-to-clear flags in the same register (RICTRL
+ * INTEN, for example) are cleared by it exactly as they are by REG |= BIT.
+ * The AHB peripherals (0x50000000: GPDMA, USB, Ethernet) are not
+ * bit-band capable.
+ *
+ * GPIO pins are accessed by port and pin number, both constants:
+ * - BITBAND_PIN_SET()/BITBAND_PIN_CLR() store to FIOSET/FIOCLR, a single
+ *   store that never touches other pins.
+ * - BITBAND_PIN_WRITE(), BITBAND_PIN_TOGGLE() and BITBAND_PIN_READ() use the
+ *   FIOPIN alias word; a toggle is a load and a store of that word, so it
+ *   can only race with a write of the same pin.
+ *
+ * Example:
+ * @code
+ * BITBAND_PIN_OUTPUT(0, 22);            // P0.22 as output
+ * BITBAND_PIN_TOGGLE(0, 22);            // ISR-safe toggle
+ * BITBAND_SET(LPC_RIT->RICTRL, 3);      // RIT timer enable, one store
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_BITBAND_H_
+#define LPC17XX_BITBAND_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup BITBAND_Public_Macros BITBAND Public Macros
+ * @{
+ */
+
+/** Bit-band regions, each one megabyte */
+#define BITBAND_SRAM_BASE (0x20000000UL)
+#define BITBAND_PERI_BASE (0x40000000UL)
+#define BITBAND_REGION_SIZE (0x00100000UL)
+/** Offset of an alias region from its bit-band region */
+#define BITBAND_ALIAS_OFFSET (0x02000000UL)
+
+/** Alias word address of bit <bit> of the word at address <addr> */
+#define BITBAND_ALIAS(addr, bit) \
+    (((addr) & 0xF0000000UL) + BITBAND_ALIAS_OFFSET + (((addr) & 0x000FFFFFUL) << 5) + ((uint32_t)(bit) << 2))
+
+/** Alias word of bit <bit> of register <reg>, an lvalue reading 0 or 1 */
+#define BITBAND_REG(reg, bit) (*(volatile uint32_t*)BITBAND_ALIAS((uint32_t) & (reg), (bit)))
+
+/** Set bit <bit> of register <reg> */
+#define BITBAND_SET(reg, bit) (BITBAND_REG(reg, bit) = 1)
+/** Clear bit <bit> of register <reg> */
+#define BITBAND_CLR(reg, bit) (BITBAND_REG(reg, bit) = 0)
+/** Write bit <bit> of register <reg>, <val> zero or not */
+#define BITBAND_WRITE(reg, bit, val) (BITBAND_REG(reg, bit) = ((val) ? 1 : 0))
+/** Read bit <bit> of register <reg>, 0 or 1 */
+#define BITBAND_GET(reg, bit) (BITBAND_REG(reg, bit))
+
+/** GPIO port register block by constant port number */
+#define BITBAND_GPIO(port) LPC_GPIO##port
+
+/** Drive pin <port>.<pin> high */
+#define BITBAND_PIN_SET(port, pin) (BITBAND_GPIO(port)->FIOSET = (1UL << (pin)))
+/** Drive pin <port>.<pin> low */
+#define BITBAND_PIN_CLR(port, pin) (BITBAND_GPIO(port)->FIOCLR = (1UL << (pin)))
+/** Drive pin <port>.<pin> to <val> */
+#define BITBAND_PIN_WRITE(port, pin, val) BITBAND_WRITE(BITBAND_GPIO(port)->FIOPIN, pin, val)
+/** Invert pin <port>.<pin> */
+#define BITBAND_PIN_TOGGLE(port, pin) (BITBAND_REG(BITBAND_GPIO(port)->FIOPIN, pin) ^= 1)
+/** Level of pin <port>.<pin>, 0 or 1 */
+#define BITBAND_PIN_READ(port, pin) BITBAND_GET(BITBAND_GPIO(port)->FIOPIN, pin)
+/** Make pin <port>.<pin> an output */
+#define BITBAND_PIN_OUTPUT(port, pin) BITBAND_SET(BITBAND_GPIO(port)->FIODIR, pin)
+/** Make pin <port>.<pin> an input */
+#define BITBAND_PIN_INPUT(port, pin) BITBAND_CLR(BITBAND_GPIO(port)->FIODIR, pin)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup BITBAND_Private_Macros BITBAND Private Macros
+ * @{
+ */
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check that an address is in a bit-band region */
+#define PARAM_BITBAND_ADDR(addr) \
+    ((((addr) - BITBAND_SRAM_BASE) < BITBAND_REGION_SIZE) || (((addr) - BITBAND_PERI_BASE) < BITBAND_REGION_SIZE))
+
+/** Compile-time check of BITBAND_ALIAS() against the alias formula, computed
+ * the other way round from the region base and byte offset (negative array
+ * size on mismatch). Evaluated by every build including this header, on the
+ * host as well as the target. */
+#define BITBAND_ASSERT_ALIAS(name, base, offset, bit)                                                               \
+    typedef char name##_bitband_alias_mismatch[(BITBAND_ALIAS((base) + (offset), (bit)) ==                          \
+                                                ((base) + BITBAND_ALIAS_OFFSET + (offset) * 32 + (bit) * 4)) &&     \
+                                                       PARAM_BITBAND_ADDR((base) + (offset))                        \
+                                                   ? 1                                                              \
+                                                   : -1]
+
+    BITBAND_ASSERT_ALIAS(BITBAND_SramFirst, BITBAND_SRAM_BASE, 0x00000UL, 0);
+    BITBAND_ASSERT_ALIAS(BITBAND_SramLast, BITBAND_SRAM_BASE, 0xFFFFCUL, 31);
+    BITBAND_ASSERT_ALIAS(BITBAND_Gpio0Pin, BITBAND_SRAM_BASE, LPC_GPIO0_BASE - BITBAND_SRAM_BASE + 0x14UL, 22);
+    BITBAND_ASSERT_ALIAS(BITBAND_Gpio4Pin, BITBAND_SRAM_BASE, LPC_GPIO4_BASE - BITBAND_SRAM_BASE + 0x18UL, 29);
+    BITBAND_ASSERT_ALIAS(BITBAND_Apb0, BITBAND_PERI_BASE, LPC_TIM0_BASE - BITBAND_PERI_BASE + 0x04UL, 1);
+    BITBAND_ASSERT_ALIAS(BITBAND_Apb1, BITBAND_PERI_BASE, LPC_SC_BASE - BITBAND_PERI_BASE + 0xC4UL, 31);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_BITBAND_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,132 @@
+/**********************************************************************
+ * $Id$		lpc17xx_bootprof.h				2026-10-18
+ *//**
+* @file		lpc17xx_bootprof.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the boot time profiler on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup BOOTPROF BOOTPROF (Boot Time Profiler)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Timestamps boot stages with the DWT cycle counter. The reset handler
+ * records its own stages when built with __BOOT_PROFILE defined; the
+ * application adds its own marks, e.g. BOOTPROF_MARK("first sample") in
+ * the first ADC interrupt, to measure time-to-first-sample after reset.
+ * @{
+ */
+
+#ifndef LPC17XX_BOOTPROF_H_
+#define LPC17XX_BOOTPROF_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup BOOTPROF_Public_Macros BOOTPROF Public Macros
+ * @{
+ */
+
+/** Maximum number of marks recorded */
+#ifndef BOOTPROF_MAX_MARKS
+#define BOOTPROF_MAX_MARKS (16)
+#endif
+
+/** Mark a boot stage, compiled out unless __BOOT_PROFILE is defined */
+#ifdef __BOOT_PROFILE
+#define BOOTPROF_MARK(name) BOOTPROF_Mark(name)
+#else
+#define BOOTPROF_MARK(name) ((void)0)
+#endif
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup BOOTPROF_Private_Macros BOOTPROF Private Macros
+ * @{
+ */
+
+/* --------------------- BIT DEFINITIONS -------------------------------------- */
+/** DWT control register */
+#define BOOTPROF_DWT_CTRL (*(volatile uint32_t*)0xE0001000)
+/** DWT cycle counter register */
+#define BOOTPROF_DWT_CYCCNT (*(volatile uint32_t*)0xE0001004)
+/** DWT_CTRL cycle counter enable */
+#define BOOTPROF_DWT_CTRL_CYCCNTENA ((uint32_t)(1 << 0))
+/** CoreDebug DEMCR trace enable, needed to use the DWT */
+#define BOOTPROF_DEMCR_TRCENA ((uint32_t)(1 << 24))
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup BOOTPROF_Public_Types BOOTPROF Public Types
+     * @{
+     */
+
+    /**
+     * @brief Boot stage mark
+     */
+    typedef struct
+    {
+        const char* Name; /**< Stage name, end of the stage */
+        uint32_t Cycles;  /**< CPU cycles since reset */
+        uint32_t ClockHz; /**< Core clock when the mark was taken, which
+                               is the clock of the stage that follows */
+    } BOOTPROF_Mark_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup BOOTPROF_Public_Functions BOOTPROF Public Functions
+     * @{
+     */
+
+    /*******************************************************************************
+     * @brief		Enable and clear the DWT cycle counter. Uses no RAM, so it
+     * 				is safe as the very first statement of the reset handler.
+     * @param[in]	None
+     * @return		None
+     *******************************************************************************/
+    static __INLINE void BOOTPROF_Start(void)
+    {
+        CoreDebug->DEMCR |= BOOTPROF_DEMCR_TRCENA;
+        BOOTPROF_DWT_CYCCNT = 0;
+        BOOTPROF_DWT_CTRL |= BOOTPROF_DWT_CTRL_CYCCNTENA;
+    }
+
+    void BOOTPROF_Mark(const char* name);
+    uint32_t BOOTPROF_GetCount(void);
+    const BOOTPROF_Mark_Type* BOOTPROF_GetMark(uint32_t index);
+    uint32_t BOOTPROF_GetStageUs(uint32_t index);
+    uint32_t BOOTPROF_GetTotalUs(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_BOOTPROF_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,144 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dacwave.h				2026-10-18
+ *//**
+* @file		lpc17xx_dacwave.h
+* @brief	Header-only compile-time DAC waveform tables on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Library group ----------------------------------------------------------- */
+/** @defgroup DACWAVE DACWAVE (Compile-time DAC Waveform Tables)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Builds one period of a waveform as a constant initializer, so the table
+ * is computed by the compiler and a const table stays in flash: no boot
+ * time loop, no multiply or divide per sample, no SRAM.
+ *
+ * Each generator is a constant expression of the sample index i, the table
+ * length N, the amplitude A and the offset O, and gives a DAC value from O
+ * to O + A (keep it within 0..1023):
+ * - DACWAVE_SINE:      O + A/2 + A/2 sin(2 pi i / N), within 0.13 % of A
+ *                      (1.3 LSB at full scale) of the exact sine
+ * - DACWAVE_TRIANGLE:  up from O to O + A in N/2 samples, then down
+ * - DACWAVE_RAMP:      sawtooth, up from O in steps of A/N
+ * - DACWAVE_TRAPEZOID: edges of N/4 samples, N/4 samples high and low
+ *
+ * DACWAVE_TABLE() gives DACR words, the value already in bits 15:6 and the
+ * bias bit (0 or DAC_BIAS_EN) or-ed in, for a DMA channel to write to DACR
+ * with word transfers straight from the table. DACWAVE_VALUES() gives the
+ * plain values, for DDS tables. N must be a power of two from 16 to 4096,
+ * written as a literal or a macro defined as one, since it selects the
+ * expansion; a generator of your own with the same parameters can be
+ * passed too.
+ *
+ * Example:
+ * @code
+ * static const uint32_t tri[1024] = { DACWAVE_TABLE(DACWAVE_TRIANGLE, 1024, 1023, 0, 0) };
+ * static const uint16_t sine[256] = { DACWAVE_VALUES(DACWAVE_SINE, 256, 1000, 12) };
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_DACWAVE_H_
+#define LPC17XX_DACWAVE_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup DACWAVE_Public_Macros DACWAVE Public Macros
+ * @{
+ */
+
+/** Sine, from the Bhaskara approximation over each half period:
+ * sin(pi t / H) ~ 16 q / (5 H^2 - 4 q) with q = t (H - t), rounded */
+#define DACWAVE_SINE(i, N, A, O)                                                                                  \
+    ((O) + (uint32_t)(((uint64_t)(A) * (DACWAVE_SINE_D(i, N) + ((i) < (N) / 2 ? 16 : -16) * DACWAVE_SINE_Q(i, N)) + \
+                       DACWAVE_SINE_D(i, N)) /                                                                    \
+                      (2 * DACWAVE_SINE_D(i, N))))
+/** Triangle, peak at N/2 */
+#define DACWAVE_TRIANGLE(i, N, A, O) \
+    ((O) + ((i) < (N) / 2 ? 2 * (A) * (i) / (N) : 2 * (A) * ((N) - (i)) / (N)))
+/** Rising sawtooth */
+#define DACWAVE_RAMP(i, N, A, O) ((O) + (A) * (i) / (N))
+/** Trapezoid: rise, high, fall, low, N/4 samples each */
+#define DACWAVE_TRAPEZOID(i, N, A, O)                                                                                \
+    ((O) + ((i) < (N) / 4       ? 4 * (A) * (i) / (N)                                                               \
+            : (i) < (N) / 2     ? (A)                                                                               \
+            : (i) < 3 * (N) / 4 ? 4 * (A) * (3 * (N) / 4 - (i)) / (N)                                               \
+                                : 0))
+
+/** DACR word of DAC value <v>, with bias bit <b> */
+#define DACWAVE_DACR(v, b) ((((uint32_t)(v) & 0x3FF) << 6) | (b))
+/** Plain DAC value <v>, bias ignored */
+#define DACWAVE_VALUE(v, b) ((uint16_t)(v))
+
+/** Initializer of N DACR words of generator <gen> */
+#define DACWAVE_TABLE(gen, N, A, O, bias) DACWAVE_EXPAND(DACWAVE_DACR, gen, N, A, O, bias)
+/** Initializer of N plain DAC values of generator <gen> */
+#define DACWAVE_VALUES(gen, N, A, O) DACWAVE_EXPAND(DACWAVE_VALUE, gen, N, A, O, 0)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup DACWAVE_Private_Macros DACWAVE Private Macros
+ * @{
+ */
+
+/** Position in the half period, t (H - t) and the Bhaskara denominator */
+#define DACWAVE_SINE_T(i, N) ((i) < (N) / 2 ? (int64_t)(i) : (int64_t)(i) - (N) / 2)
+#define DACWAVE_SINE_Q(i, N) (DACWAVE_SINE_T(i, N) * ((N) / 2 - DACWAVE_SINE_T(i, N)))
+#define DACWAVE_SINE_D(i, N) (5 * (int64_t)((N) / 2) * ((N) / 2) - 4 * DACWAVE_SINE_Q(i, N))
+
+/** Expand N, a macro argument may be a macro itself */
+#define DACWAVE_EXPAND(w, gen, N, A, O, b) DACWAVE_EXPAND_(w, gen, N, A, O, b)
+#define DACWAVE_EXPAND_(w, gen, N, A, O, b) DACWAVE_REP_##N(w, gen, 0, N, A, O, b)
+
+/** Samples i to i + n - 1, each followed by a comma */
+#define DACWAVE_REP_1(w, g, i, N, A, O, b) w(g(i, N, A, O), b),
+#define DACWAVE_REP_2(w, g, i, N, A, O, b) DACWAVE_REP_1(w, g, i, N, A, O, b) DACWAVE_REP_1(w, g, (i) + 1, N, A, O, b)
+#define DACWAVE_REP_4(w, g, i, N, A, O, b) DACWAVE_REP_2(w, g, i, N, A, O, b) DACWAVE_REP_2(w, g, (i) + 2, N, A, O, b)
+#define DACWAVE_REP_8(w, g, i, N, A, O, b) DACWAVE_REP_4(w, g, i, N, A, O, b) DACWAVE_REP_4(w, g, (i) + 4, N, A, O, b)
+#define DACWAVE_REP_16(w, g, i, N, A, O, b) \
+    DACWAVE_REP_8(w, g, i, N, A, O, b) DACWAVE_REP_8(w, g, (i) + 8, N, A, O, b)
+#define DACWAVE_REP_32(w, g, i, N, A, O, b) \
+    DACWAVE_REP_16(w, g, i, N, A, O, b) DACWAVE_REP_16(w, g, (i) + 16, N, A, O, b)
+#define DACWAVE_REP_64(w, g, i, N, A, O, b) \
+    DACWAVE_REP_32(w, g, i, N, A, O, b) DACWAVE_REP_32(w, g, (i) + 32, N, A, O, b)
+#define DACWAVE_REP_128(w, g, i, N, A, O, b) \
+    DACWAVE_REP_64(w, g, i, N, A, O, b) DACWAVE_REP_64(w, g, (i) + 64, N, A, O, b)
+#define DACWAVE_REP_256(w, g, i, N, A, O, b) \
+    DACWAVE_REP_128(w, g, i, N, A, O, b) DACWAVE_REP_128(w, g, (i) + 128, N, A, O, b)
+#define DACWAVE_REP_512(w, g, i, N, A, O, b) \
+    DACWAVE_REP_256(w, g, i, N, A, O, b) DACWAVE_REP_256(w, g, (i) + 256, N, A, O, b)
+#define DACWAVE_REP_1024(w, g, i, N, A, O, b) \
+    DACWAVE_REP_512(w, g, i, N, A, O, b) DACWAVE_REP_512(w, g, (i) + 512, N, A, O, b)
+#define DACWAVE_REP_2048(w, g, i, N, A, O, b) \
+    DACWAVE_REP_1024(w, g, i, N, A, O, b) DACWAVE_REP_1024(w, g, (i) + 1024, N, A, O, b)
+#define DACWAVE_REP_4096(w, g, i, N, A, O, b) \
+    DACWAVE_REP_2048(w, g, i, N, A, O, b) DACWAVE_REP_2048(w, g, (i) + 2048, N, A, O, b)
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_DACWAVE_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,139 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dds.h				2026-10-18
+ *//**
+* @file		lpc17xx_dds.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for direct digital synthesis on the LPC17xx DAC
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup DDS DDS (Direct Digital Synthesis)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Plays a waveform table on the DAC at any frequency. The DAC takes one
+ * sample per DMA request at a fixed update rate (the DAC timeout counter,
+ * double buffered); the frequency is set by the step of a 32 bit phase
+ * accumulator instead, whose top bits index the table:
+ *
+ *   step = frequency * 2^32 / rate
+ *
+ * which gives a resolution of rate / 2^32, far below one millihertz. With
+ * interpolation, the next 16 bits of the phase interpolate linearly between
+ * neighbouring table entries.
+ *
+ * Samples are generated a block at a time into the halves of a ping-pong
+ * buffer moved to DACR by a GPDMA channel; each half is refilled from the
+ * GPDMA dispatcher when the DMA moves on to the other one. A new frequency
+ * or table takes effect at the next block with the phase carried over, so
+ * hops are continuous and DAC_SetDMATimeOut() is never called again.
+ *
+ * Tables hold 2^n 10 bit DAC values (0..1023), one period. The buffer and
+ * the two linked list items must be in AHB SRAM (0x2007C000); the table
+ * can be anywhere, it is read by the CPU.
+ *
+ * Usage:
+ *   void DMA_IRQHandler(void) { GPDMA_IntHandler(); }
+ *   ...
+ *   DAC_Init(LPC_DAC);
+ *   GPDMA_Init();
+ *   DDS_Init(&dds_cfg);
+ *   DDS_SetFrequency(60000);   // 60.000 Hz
+ *   DDS_Start();
+ *   ...
+ *   DDS_SetFrequency(120000);
+ * @{
+ */
+
+#ifndef LPC17XX_DDS_H_
+#define LPC17XX_DDS_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_gpdma.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup DDS_Public_Macros DDS Public Macros
+ * @{
+ */
+
+/** Most samples in one half buffer */
+#define DDS_MAX_HALF_SAMPLES (4095)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup DDS_Private_Macros DDS Private Macros
+ * @{
+ */
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check the table size, 2^2 to 2^16 entries */
+#define PARAM_DDS_TABLE_BITS(n) (((n) >= 2) && ((n) <= 16))
+/** Macro to check the half buffer length */
+#define PARAM_DDS_SAMPLES(n) (((n) != 0) && ((n) <= DDS_MAX_HALF_SAMPLES))
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup DDS_Public_Types DDS Public Types
+     * @{
+     */
+
+    /**
+     * @brief DDS configuration structure
+     */
+    typedef struct
+    {
+        uint32_t RateHz;        /**< DAC update rate, at most 1 MHz (400 kHz in low power) */
+        const uint16_t* Table;  /**< Waveform table, 2^TableBits DAC values */
+        uint8_t TableBits;      /**< log2 of the table size, 2..16 */
+        uint8_t Interpolate;    /**< TRUE for linear interpolation */
+        uint32_t* Buffer;       /**< 2 * Samples DACR words, in AHB SRAM */
+        uint32_t Samples;       /**< Samples per half buffer */
+        GPDMA_LLI_Type* Lli;    /**< 2 linked list items, in AHB SRAM */
+        uint32_t PrioClass;     /**< Channel priority class, GPDMA_PRIO_x */
+    } DDS_CFG_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup DDS_Public_Functions DDS Public Functions
+     * @{
+     */
+
+    Status DDS_Init(const DDS_CFG_Type* DDSConfigStruct);
+    void DDS_Start(void);
+    void DDS_Stop(void);
+    void DDS_SetFrequency(uint32_t milliHz);
+    void DDS_SetTable(const uint16_t* table, uint8_t tableBits, Bool interpolate);
+    uint32_t DDS_GetRate(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_DDS_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
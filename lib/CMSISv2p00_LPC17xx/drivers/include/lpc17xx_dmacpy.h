@@ -0,0 +1,167 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dmacpy.h				2026-10-18
+ *//**
+* @file		lpc17xx_dmacpy.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for DMA memory copy and fill on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup DMACPY DMACPY (DMA Memory Copy and Fill)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Asynchronous memcpy and memset. A copy or fill of at least the threshold
+ * size, between word aligned addresses in AHB SRAM, runs on a free GPDMA
+ * channel (GPDMA_PRIO_LOW, 32 bit words, in chunks of 4095 words) while the
+ * CPU goes on; anything else runs on the CPU at once, with an unrolled word
+ * loop the compiler turns into LDM/STM pairs. Either way the operation is
+ * its own future: poll it with DMACPY_IsDone(), wait for it with
+ * DMACPY_Wait(), or give a callback.
+ *
+ * The threshold is where the DMA setup and completion interrupt cost as
+ * much as the CPU copy; DMACPY_Calibrate() measures it on the target with
+ * the DWT cycle counter.
+ *
+ * DMACPY_MeasureStall() shows what a DMA stream costs the CPU: it times a
+ * load/store loop over some data with the bus idle and again while a DMA
+ * copy streams through a scratch buffer. With the data in the scratch
+ * buffer's AHB bank the CPU waits for the matrix arbiter; with the data
+ * in local SRAM (plain .bss) or in the other bank it should not.
+ *
+ * The GPDMA cannot reach the local SRAM at 0x10000000 nor is its access to
+ * flash used here; a fill also needs the operation itself in AHB SRAM, its
+ * fill word is the DMA source.
+ *
+ * Usage:
+ *   void DMA_IRQHandler(void) { GPDMA_IntHandler(); }
+ *   ...
+ *   GPDMA_Init();
+ *   DMACPY_Init();
+ *   DMACPY_Copy(&op, frame, packet, 1536, NULL, NULL);
+ *   ...
+ *   DMACPY_Wait(&op);
+ * @{
+ */
+
+#ifndef LPC17XX_DMACPY_H_
+#define LPC17XX_DMACPY_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup DMACPY_Public_Macros DMACPY Public Macros
+ * @{
+ */
+
+/** Default DMA threshold in bytes, until DMACPY_Calibrate() or
+ * DMACPY_SetThreshold() */
+#define DMACPY_DEFAULT_THRESHOLD (256)
+
+/** Operation states */
+#define DMACPY_IDLE (0)    /**< Not started */
+#define DMACPY_PENDING (1) /**< Running on a DMA channel */
+#define DMACPY_DONE (2)    /**< Finished */
+#define DMACPY_FAILED (3)  /**< Stopped by a DMA error */
+
+/** DMACPY_MeasureStall() result when the DMA copy did not last as long as
+ * the CPU loop */
+#define DMACPY_STALL_UNCOVERED (0xFFFFFFFF)
+/** DMACPY_MeasureStall() result when the copy could not run on a DMA
+ * channel: none free, or scratch not in AHB SRAM */
+#define DMACPY_STALL_NO_CHANNEL (0xFFFFFFFE)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup DMACPY_Private_Macros DMACPY Private Macros
+ * @{
+ */
+
+/** AHB SRAM, the memory used by DMA here */
+#define DMACPY_AHB_START (0x2007C000UL)
+#define DMACPY_AHB_END (0x20084000UL)
+
+/** Most words moved by one DMA transfer */
+#define DMACPY_MAX_CHUNK (4095)
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup DMACPY_Public_Types DMACPY Public Types
+     * @{
+     */
+
+    /** Completion callback, from the DMA interrupt, or from the call itself
+     * when done on the CPU */
+    typedef void (*DMACPY_Callback)(void* arg);
+
+    /**
+     * @brief Copy or fill operation, owned by the caller until done
+     */
+    typedef struct
+    {
+        uint32_t Dst;   /**< Next destination address */
+        uint32_t Src;   /**< Next source address */
+        uint32_t Words; /**< Words left */
+        uint32_t Fill;  /**< Fill word, the source of a fill */
+        DMACPY_Callback Callback;
+        void* Arg;
+        uint8_t ChannelNum;
+        uint8_t IsFill;
+        volatile uint8_t State; /**< DMACPY_x state */
+    } DMACPY_Op_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup DMACPY_Public_Functions DMACPY Public Functions
+     * @{
+     */
+
+    void DMACPY_Init(void);
+    void DMACPY_SetThreshold(uint32_t bytes);
+    uint32_t DMACPY_GetThreshold(void);
+    void DMACPY_Copy(DMACPY_Op_Type* op,
+                     void* dst,
+                     const void* src,
+                     uint32_t len,
+                     DMACPY_Callback callback,
+                     void* arg);
+    void DMACPY_Set(DMACPY_Op_Type* op, void* dst, uint8_t value, uint32_t len, DMACPY_Callback callback, void* arg);
+    Bool DMACPY_IsDone(const DMACPY_Op_Type* op);
+    uint8_t DMACPY_Wait(const DMACPY_Op_Type* op);
+    void DMACPY_CpuCopy(void* dst, const void* src, uint32_t len);
+    void DMACPY_CpuSet(void* dst, uint8_t value, uint32_t len);
+    uint32_t DMACPY_Calibrate(void* scratch, uint32_t size);
+    uint32_t DMACPY_MeasureStall(void* scratch, uint32_t size, volatile uint32_t* data, uint32_t words);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_DMACPY_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,170 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dmapace.h				2026-10-18
+ *//**
+* @file		lpc17xx_dmapace.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for timer-paced DMA copies on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup DMAPACE DMAPACE (Timer-Paced DMA Copy)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Copies a block of 8, 16 or 32 bit items between any two addresses, one
+ * item per match of a timer match register: MAT0.0 to MAT3.1 are GPDMA
+ * request lines (through DMAREQSEL), so the match itself is the DMA flow
+ * control request and the copy runs with no interrupt per item. The timer
+ * resets on the match and runs from CCLK. A single callback runs when the
+ * last item has been moved, or on a DMA error.
+ *
+ * Source and destination can each be incremented or fixed, e.g. a table to
+ * a DAC or match register, or a peripheral register sampled into a buffer.
+ * DMAPACE_Loop() repeats the block until DMAPACE_Abort(), with no callback.
+ *
+ * The block is split in chunks of up to 4095 items, one per linked list
+ * item; a single chunk copied once needs no linked list item. The GPDMA
+ * cannot reach the local SRAM at 0x10000000: buffers and linked list items
+ * must be in AHB SRAM (0x2007C000).
+ *
+ * The channel is taken with GPDMA_ChannelAlloc() and the completion comes
+ * through the GPDMA dispatcher, so DMA_IRQHandler() must call
+ * GPDMA_IntHandler().
+ *
+ * Usage:
+ *   void DMA_IRQHandler(void) { GPDMA_IntHandler(); }
+ *   ...
+ *   GPDMA_Init();
+ *   DMAPACE_Init(&pace, &cfg);
+ *   DMAPACE_Copy(&pace, (void*)&LPC_DAC->DACR, samples, 256, NULL, 0, done, NULL);
+ * @{
+ */
+
+#ifndef LPC17XX_DMAPACE_H_
+#define LPC17XX_DMAPACE_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_gpdma.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup DMAPACE_Public_Macros DMAPACE Public Macros
+ * @{
+ */
+
+/** Most items moved by the channel registers or one linked list item */
+#define DMAPACE_MAX_CHUNK (4095)
+
+/** Number of linked list items needed for a block of <len> items, one per
+ * chunk of DMAPACE_MAX_CHUNK items */
+#define DMAPACE_LLI_COUNT(len) (((len) + DMAPACE_MAX_CHUNK - 1) / DMAPACE_MAX_CHUNK)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup DMAPACE_Private_Macros DMAPACE Private Macros
+ * @{
+ */
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check the match channel, only MR0 and MR1 request DMA */
+#define PARAM_DMAPACE_MATCH_CHANNEL(n) ((n) <= 1)
+/** Macro to check the item width */
+#define PARAM_DMAPACE_WIDTH(n) ((n) <= GPDMA_WIDTH_WORD)
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup DMAPACE_Public_Types DMAPACE Public Types
+     * @{
+     */
+
+    /** Completion callback, called from the DMA interrupt */
+    typedef void (*DMAPACE_Callback)(void* arg);
+
+    /**
+     * @brief Paced copy configuration structure
+     */
+    typedef struct
+    {
+        LPC_TIM_TypeDef* TIMx; /**< Pacing timer, LPC_TIM0..3, used by this copier only */
+        uint8_t MatchChannel;  /**< Match register requesting DMA, 0 or 1 */
+        uint8_t Width;         /**< Item width, GPDMA_WIDTH_BYTE/HALFWORD/WORD */
+        uint8_t SrcInc;        /**< TRUE to increment the source address */
+        uint8_t DstInc;        /**< TRUE to increment the destination address */
+        uint32_t RateHz;       /**< Items per second */
+        uint32_t PrioClass;    /**< Channel priority class, GPDMA_PRIO_x */
+    } DMAPACE_CFG_Type;
+
+    /**
+     * @brief Paced copier, filled in by DMAPACE_Init()
+     */
+    typedef struct
+    {
+        LPC_GPDMACH_TypeDef* Channel;
+        LPC_TIM_TypeDef* TIMx;
+        uint32_t Control; /**< Channel control bits, without transfer size */
+        uint32_t Config;  /**< Channel configuration bits, without enable */
+        DMAPACE_Callback Callback;
+        void* Arg;
+        uint8_t ChannelNum;
+        uint8_t MatchChannel;
+        uint8_t Width;
+        volatile uint8_t Busy;
+        volatile uint8_t Failed; /**< TRUE if the last copy ended on a DMA error */
+    } DMAPACE_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup DMAPACE_Public_Functions DMAPACE Public Functions
+     * @{
+     */
+
+    Status DMAPACE_Init(DMAPACE_Type* pace, const DMAPACE_CFG_Type* DMAPACEConfigStruct);
+    void DMAPACE_DeInit(DMAPACE_Type* pace);
+    Status DMAPACE_Copy(DMAPACE_Type* pace,
+                        void* dst,
+                        const void* src,
+                        uint32_t count,
+                        GPDMA_LLI_Type* lli,
+                        uint32_t numLLI,
+                        DMAPACE_Callback callback,
+                        void* arg);
+    Status DMAPACE_Loop(DMAPACE_Type* pace,
+                        void* dst,
+                        const void* src,
+                        uint32_t count,
+                        GPDMA_LLI_Type* lli,
+                        uint32_t numLLI);
+    void DMAPACE_Abort(DMAPACE_Type* pace);
+    Bool DMAPACE_IsBusy(const DMAPACE_Type* pace);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_DMAPACE_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
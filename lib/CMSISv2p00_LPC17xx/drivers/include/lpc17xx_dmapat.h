@@ -0,0 +1,163 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dmapat.h				2026-10-18
+ *//**
+* @file		lpc17xx_dmapat.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for DMA-driven GPIO pattern output on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup DMAPAT DMAPAT (DMA GPIO Pattern Player)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Streams a buffer of 8, 16 or 32 bit port words to a GPIO port with a
+ * GPDMA channel, one word per match of a timer match register (MR0 or MR1,
+ * the only ones with a DMA request). The timer resets on the match, so the
+ * words are written at a fixed rate with no CPU involvement; the timer runs
+ * from CCLK, so rates of several MHz are possible.
+ *
+ * A player is a timer-paced copy (DMAPACE) to a fixed GPIO register: the
+ * buffer is split in GPDMA linked list items of up to 4095 words and, with
+ * looping, the last item links back to the first one and the pattern
+ * repeats until DMAPAT_Stop(). The end of a pattern played once comes
+ * through the GPDMA dispatcher, so DMA_IRQHandler() must call
+ * GPDMA_IntHandler().
+ *
+ * Words written to FIOPIN change every pin of the lane; pins that are not
+ * part of the pattern must be masked with FIO_SetMask() first (the mask
+ * applies to FIOSET and FIOCLR too). The buffer and the linked list items
+ * must be in AHB SRAM (0x2007C000), the GPDMA cannot reach the local SRAM
+ * at 0x10000000.
+ *
+ * Usage:
+ *   void DMA_IRQHandler(void) { GPDMA_IntHandler(); }
+ *   ...
+ *   static GPDMA_LLI_Type lli[DMAPAT_LLI_COUNT(64)];
+ *   static uint8_t frame[64];
+ *   ...
+ *   GPDMA_Init();
+ *   DMAPAT_Init(&player, &cfg);
+ *   DMAPAT_Play(&player, frame, 64, lli, DMAPAT_LLI_COUNT(64), TRUE);
+ * @{
+ */
+
+#ifndef LPC17XX_DMAPAT_H_
+#define LPC17XX_DMAPAT_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_dmapace.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup DMAPAT_Public_Macros DMAPAT Public Macros
+ * @{
+ */
+
+/** Most words moved by one linked list item */
+#define DMAPAT_MAX_LLI_WORDS DMAPACE_MAX_CHUNK
+
+/** Number of linked list items needed for a buffer of <len> words */
+#define DMAPAT_LLI_COUNT(len) DMAPACE_LLI_COUNT(len)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup DMAPAT_Private_Macros DMAPAT Private Macros
+ * @{
+ */
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check the GPIO port */
+#define PARAM_DMAPAT_PORT(n) ((n) <= 4)
+/** Macro to check the target register */
+#define PARAM_DMAPAT_TARGET(n) ((n) <= DMAPAT_TARGET_CLR)
+/** Macro to check the byte lane of a word width, lane aligned to the width */
+#define PARAM_DMAPAT_LANE(width, lane) \
+    (((width) <= GPDMA_WIDTH_WORD) && ((lane) <= 3) && (((lane) & ((1UL << (width)) - 1)) == 0))
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup DMAPAT_Public_Types DMAPAT Public Types
+     * @{
+     */
+
+    /**
+     * @brief GPIO register written by the pattern
+     */
+    typedef enum
+    {
+        DMAPAT_TARGET_PIN = 0, /**< FIOPIN, each word sets the level of all pins */
+        DMAPAT_TARGET_SET,     /**< FIOSET, one bits drive their pin high */
+        DMAPAT_TARGET_CLR      /**< FIOCLR, one bits drive their pin low */
+    } DMAPAT_TARGET_Type;
+
+    /**
+     * @brief Pattern player configuration structure
+     */
+    typedef struct
+    {
+        LPC_TIM_TypeDef* TIMx;     /**< Pacing timer, LPC_TIM0..3, used by this player only */
+        uint8_t MatchChannel;      /**< Match register requesting DMA, 0 or 1 */
+        uint8_t Portnum;           /**< GPIO port, 0..4 */
+        DMAPAT_TARGET_Type Target; /**< Register written */
+        uint8_t Width;             /**< Word width, GPDMA_WIDTH_BYTE/HALFWORD/WORD */
+        uint8_t Lane;              /**< Byte offset of the word in the register,
+                                        0..3 for bytes, 0 or 2 for half-words, 0 for words */
+        uint32_t RateHz;           /**< Words per second */
+        uint32_t PrioClass;        /**< Channel priority class, GPDMA_PRIO_x */
+    } DMAPAT_CFG_Type;
+
+    /**
+     * @brief Pattern player, filled in by DMAPAT_Init()
+     */
+    typedef struct
+    {
+        DMAPACE_Type Pace; /**< Paced copy to the GPIO register */
+        uint32_t DstAddr;  /**< GPIO register address */
+    } DMAPAT_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup DMAPAT_Public_Functions DMAPAT Public Functions
+     * @{
+     */
+
+    Status DMAPAT_Init(DMAPAT_Type* pat, const DMAPAT_CFG_Type* DMAPATConfigStruct);
+    void DMAPAT_DeInit(DMAPAT_Type* pat);
+    Status DMAPAT_Play(DMAPAT_Type* pat, const void* buffer, uint32_t length, GPDMA_LLI_Type* lli, uint32_t numLLI,
+                       Bool loop);
+    void DMAPAT_Stop(DMAPAT_Type* pat);
+    Bool DMAPAT_IsBusy(const DMAPAT_Type* pat);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_DMAPAT_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,146 @@
+/**********************************************************************
+ * $Id$		lpc17xx_envgen.h				2026-10-18
+ *//**
+* @file		lpc17xx_envgen.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for DMA-played DAC envelopes on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup ENVGEN ENVGEN (DAC Envelope Generator)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Repeats a rise/hold/fall/settle envelope on the DAC entirely in hardware.
+ * The envelope parameters are compiled into a circular chain of GPDMA
+ * linked list items that write DACR at one common rate, paced by the DAC
+ * timeout counter:
+ * - the rise and fall ramps are sample words in the ramp buffer, one per
+ *   DAC update;
+ * - hold and settle are constant segments: one word, read again and again
+ *   with the source increment off, whatever their length.
+ *
+ * So memory grows with the ramp times only, and the CPU is not involved
+ * once started, except for one terminal count interrupt per cycle.
+ *
+ * Two banks of linked list items and ramp words are kept. ENVGEN_Update()
+ * compiles the new envelope into the idle bank and links the last item of
+ * the playing chain to it, so the change takes effect at the next cycle
+ * boundary, without a glitch. If the DMA has already loaded that last item,
+ * it takes one more cycle. A further update is refused until the switch is
+ * done.
+ *
+ * ENVGEN and DDS both own the DAC, use one at a time.
+ *
+ * Usage:
+ *   void DMA_IRQHandler(void) { GPDMA_IntHandler(); }
+ *   ...
+ *   DAC_Init(LPC_DAC);
+ *   GPDMA_Init();
+ *   ENVGEN_Init(&env_cfg);              // 1 kHz: 1 ms steps
+ *   ENVGEN_Unpack(*(uint32_t*)0x10004000, &env);
+ *   ENVGEN_Start(&env);
+ *   ...
+ *   env.RiseMs = 20;
+ *   while (ENVGEN_Update(&env) == ERROR);
+ * @{
+ */
+
+#ifndef LPC17XX_ENVGEN_H_
+#define LPC17XX_ENVGEN_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_gpdma.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup ENVGEN_Public_Macros ENVGEN Public Macros
+ * @{
+ */
+
+/** Linked list items per bank; each segment takes one per 4095 samples */
+#define ENVGEN_MAX_LLI (12)
+
+/**
+ * @}
+ */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup ENVGEN_Public_Types ENVGEN Public Types
+     * @{
+     */
+
+    /**
+     * @brief Envelope parameters; a zero time leaves the segment out
+     */
+    typedef struct
+    {
+        uint16_t MaxValue; /**< Peak DAC value, 0..1023; the envelope starts and settles at 0 */
+        uint16_t RiseMs;   /**< Ramp from 0 up to MaxValue */
+        uint16_t HoldMs;   /**< At MaxValue */
+        uint16_t FallMs;   /**< Ramp from MaxValue down to 0 */
+        uint16_t SettleMs; /**< At 0 */
+    } ENVGEN_PARAM_Type;
+
+    /**
+     * @brief One bank, must be in AHB SRAM
+     */
+    typedef struct
+    {
+        GPDMA_LLI_Type Lli[ENVGEN_MAX_LLI];
+        uint32_t Level[2]; /**< Hold and settle DACR words */
+        uint32_t* Ramp;    /**< Rise and fall DACR words */
+        uint8_t Last;      /**< Index of the last item of the chain */
+    } ENVGEN_BANK_Type;
+
+    /**
+     * @brief Envelope generator configuration structure
+     */
+    typedef struct
+    {
+        uint32_t RateHz;        /**< DAC update rate, the time resolution */
+        ENVGEN_BANK_Type* Bank; /**< 2 banks, in AHB SRAM */
+        uint32_t* Buffer;       /**< 2 * Words ramp words, in AHB SRAM */
+        uint32_t Words;         /**< Ramp words per bank, rise plus fall samples */
+        uint32_t PrioClass;     /**< Channel priority class, GPDMA_PRIO_x */
+    } ENVGEN_CFG_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup ENVGEN_Public_Functions ENVGEN Public Functions
+     * @{
+     */
+
+    Status ENVGEN_Init(const ENVGEN_CFG_Type* ENVGENConfigStruct);
+    Status ENVGEN_Start(const ENVGEN_PARAM_Type* param);
+    Status ENVGEN_Update(const ENVGEN_PARAM_Type* param);
+    void ENVGEN_Stop(void);
+    Bool ENVGEN_IsPending(void);
+    uint32_t ENVGEN_GetCycles(void);
+    void ENVGEN_Unpack(uint32_t control, ENVGEN_PARAM_Type* param);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_ENVGEN_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,149 @@
+/**********************************************************************
+ * $Id$		lpc17xx_flashkv.h				2026-10-18
+ *//**
+* @file		lpc17xx_flashkv.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the wear-leveled flash key/value store on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup FLASHKV FLASHKV (Flash Key/Value Store)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Log-structured store built on the IAP commands. Records are appended to
+ * 256 byte pages (the smallest IAP write), each page is written once after
+ * an erase. When the active sector is full the live records are compacted
+ * into the next sector of the ring, so every sector is erased once per turn.
+ *
+ * Sector layout: page 0 holds the sector header (written last during a
+ * compaction, so an interrupted compaction leaves the old sector active),
+ * pages 1..n hold up to 8 records of 32 bytes each.
+ * @{
+ */
+
+#ifndef LPC17XX_FLASHKV_H_
+#define LPC17XX_FLASHKV_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup FLASHKV_Public_Macros FLASHKV Public Macros
+ * @{
+ */
+
+/** Number of keys, valid keys are 0..FLASHKV_MAX_KEYS-1 */
+#ifndef FLASHKV_MAX_KEYS
+#define FLASHKV_MAX_KEYS (32)
+#endif
+
+/** Maximum value length in bytes */
+#define FLASHKV_MAX_VALUE_LEN (24)
+
+/** Size of a flash page, smallest IAP write */
+#define FLASHKV_PAGE_SIZE (256)
+
+/** Size of one record */
+#define FLASHKV_RECORD_SIZE (32)
+
+/** Records per page */
+#define FLASHKV_RECORDS_PER_PAGE (FLASHKV_PAGE_SIZE / FLASHKV_RECORD_SIZE)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup FLASHKV_Private_Macros FLASHKV Private Macros
+ * @{
+ */
+
+/** Key value of an erased record slot */
+#define FLASHKV_KEY_BLANK ((uint16_t)0xFFFF)
+/** Key value of the sector header record */
+#define FLASHKV_KEY_HEADER ((uint16_t)0xFFFE)
+/** Length value of a deleted key */
+#define FLASHKV_LEN_TOMBSTONE ((uint8_t)0xFF)
+/** Sector header magic */
+#define FLASHKV_MAGIC ((uint32_t)0x4B564C31)
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check key */
+#define PARAM_FLASHKV_KEY(n) ((n) < FLASHKV_MAX_KEYS)
+/** Macro to check value length */
+#define PARAM_FLASHKV_LEN(n) ((n) <= FLASHKV_MAX_VALUE_LEN)
+/** Macro to check sector range, all sectors must have the same size */
+#define PARAM_FLASHKV_SECTORS(first, num)                                                                           \
+    (((num) >= 2) && (((first) + (num) <= 16) || (((first) >= 16) && ((first) + (num) <= 30))))
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup FLASHKV_Public_Types FLASHKV Public Types
+     * @{
+     */
+
+    /**
+     * @brief Flash record, 32 bytes
+     */
+    typedef struct
+    {
+        uint16_t Key;                         /**< Key, FLASHKV_KEY_BLANK if slot unused */
+        uint8_t Length;                       /**< Value length, FLASHKV_LEN_TOMBSTONE if deleted */
+        uint8_t Reserved;                     /**< Written as 0xFF */
+        uint8_t Data[FLASHKV_MAX_VALUE_LEN];  /**< Value */
+        uint32_t Crc;                         /**< CRC-32 of the 28 preceding bytes */
+    } FLASHKV_Record_Type;
+
+    /**
+     * @brief Store configuration structure
+     */
+    typedef struct
+    {
+        uint32_t FirstSector; /**< First IAP sector number of the store */
+        uint32_t NumSectors;  /**< Number of sectors, should be >= 2, all 4 kB (0..15)
+                                   or all 32 kB (16..29) */
+    } FLASHKV_CFG_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup FLASHKV_Public_Functions FLASHKV Public Functions
+     * @{
+     */
+
+    Status FLASHKV_Init(const FLASHKV_CFG_Type* FLASHKVConfigStruct);
+    Status FLASHKV_Set(uint16_t key, const void* value, uint8_t length);
+    Status FLASHKV_Delete(uint16_t key);
+    Status FLASHKV_Commit(void);
+    const uint8_t* FLASHKV_GetPtr(uint16_t key, uint8_t* length);
+    Status FLASHKV_Get(uint16_t key, void* value, uint8_t* length);
+    uint32_t FLASHKV_GetGeneration(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_FLASHKV_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
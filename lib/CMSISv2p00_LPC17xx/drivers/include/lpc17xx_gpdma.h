@@ -104,6 +104,14 @@ extern "C"
 #define GPDMA_REQSEL_UART  ((0UL)) /**< UART TX/RX is selected */
 #define GPDMA_REQSEL_TIMER ((1UL)) /**< Timer match is selected */
 
+/** Channel allocation priority classes, channel 0 has the highest hardware priority */
+#define GPDMA_PRIO_HIGH   ((0UL)) /**< Any channel, lowest number first */
+#define GPDMA_PRIO_NORMAL ((1UL)) /**< Channels 2 to 7, lowest number first */
+#define GPDMA_PRIO_LOW    ((2UL)) /**< Channels 2 to 7, highest number first */
+
+/** Returned by GPDMA_ChannelAlloc() when no channel is free */
+#define GPDMA_CHANNEL_NONE ((0xFF))
+
 /**
  * @}
  */
@@ -297,6 +305,12 @@ extern "C"
 
 /* Macros check GPDMA request select type */
 #define PARAM_GPDMA_REQSEL(n) ((n == GPDMA_REQSEL_UART) || (n == GPDMA_REQSEL_TIMER))
+
+/* Macros check GPDMA channel priority class */
+#define PARAM_GPDMA_PRIO(n) ((n == GPDMA_PRIO_HIGH) || (n == GPDMA_PRIO_NORMAL) || (n == GPDMA_PRIO_LOW))
+
+/** Channels kept for GPDMA_PRIO_HIGH, 0 and 1 */
+#define GPDMA_HIGH_CHANNELS (2)
     /**
      * @}
      */
@@ -406,6 +420,22 @@ extern "C"
         uint32_t Control; /**< GPDMA Control of this LLI */
     } GPDMA_LLI_Type;
 
+    /**
+     * @brief GPDMA channel program, the register values of a compiled
+     * channel configuration
+     */
+    typedef struct
+    {
+        uint32_t SrcAddr; /**< DMACCSrcAddr */
+        uint32_t DstAddr; /**< DMACCDestAddr */
+        uint32_t LLI;     /**< DMACCLLI */
+        uint32_t Control; /**< DMACCControl */
+        uint32_t Config;  /**< DMACCConfig, without the enable bit */
+    } GPDMA_PROGRAM_Type;
+
+    /** Channel callback, called from GPDMA_IntHandler() */
+    typedef void (*GPDMA_Callback)(uint8_t channelNum, void* arg);
+
     /**
      * @}
      */
@@ -418,10 +448,16 @@ extern "C"
     void GPDMA_Init(void);
     // Status GPDMA_Setup(GPDMA_Channel_CFG_Type *GPDMAChannelConfig, fnGPDMACbs_Type *pfnGPDMACbs);
     Status GPDMA_Setup(GPDMA_Channel_CFG_Type* GPDMAChannelConfig);
+    Status GPDMA_Compile(const GPDMA_Channel_CFG_Type* GPDMAChannelConfig, GPDMA_PROGRAM_Type* GPDMAProgram);
+    void GPDMA_Arm(uint8_t channelNum, const GPDMA_PROGRAM_Type* GPDMAProgram);
     IntStatus GPDMA_IntGetStatus(GPDMA_Status_Type type, uint8_t channel);
     void GPDMA_ClearIntPending(GPDMA_StateClear_Type type, uint8_t channel);
     void GPDMA_ChannelCmd(uint8_t channelNum, FunctionalState NewState);
-    // void GPDMA_IntHandler(void);
+    uint8_t GPDMA_ChannelAlloc(uint32_t prioClass, Bool autoFree);
+    void GPDMA_ChannelFree(uint8_t channelNum);
+    Status GPDMA_ReqSelClaim(uint8_t channelNum, uint32_t conn);
+    void GPDMA_SetCallback(uint8_t channelNum, GPDMA_Callback tcCallback, GPDMA_Callback errCallback, void* arg);
+    void GPDMA_IntHandler(void);
 
     /**
      * @}
@@ -133,6 +133,7 @@ extern "C"
     void GPIO_ClearValue(uint8_t portNum, uint32_t bitValue);
     uint32_t GPIO_ReadValue(uint8_t portNum);
     void GPIO_IntCmd(uint8_t portNum, uint32_t bitValue, uint8_t edgeState);
+    void GPIO_IntDisable(uint8_t portNum, uint32_t bitValue, uint8_t edgeState);
     FunctionalState GPIO_GetIntStatus(uint8_t portNum, uint32_t pinNum, uint8_t edgeState);
     void GPIO_ClearInt(uint8_t portNum, uint32_t bitValue);
 
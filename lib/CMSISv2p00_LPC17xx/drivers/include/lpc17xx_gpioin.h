@@ -0,0 +1,151 @@
+/**********************************************************************
+ * $Id$		lpc17xx_gpioin.h				2026-10-18
+ *//**
+* @file		lpc17xx_gpioin.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for debounced GPIO interrupt inputs on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup GPIOIN GPIOIN (Debounced GPIO Inputs)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Buttons and switches on any number of port 0 and port 2 pins, all served
+ * by the shared GPIO interrupt (EINT3). The interrupt handler only stamps
+ * the first edge of a burst with the timer wheel counter and restarts the
+ * pin's debounce timer on every bounce. When the pin has been quiet for the
+ * debounce time, its level is read; a level that differs from the last
+ * reported one is queued as an event, stamped with the time of the edge
+ * that started the burst.
+ *
+ * The EINT0..EINT2 buttons (P2.10..P2.12) can be used here with the pins in
+ * GPIO function (PINSEL_FUNC_0) instead of the EINT function.
+ *
+ * Usage:
+ *   void EINT3_IRQHandler(void) { GPIOIN_IRQHandler(); }
+ *   ...
+ *   GPIOIN_Init();
+ *   GPIOIN_ConfigPin(&button_cfg);
+ *   NVIC_EnableIRQ(EINT3_IRQn);
+ *   while (1)
+ *   {
+ *       TMRWHEEL_Dispatch();
+ *       while (GPIOIN_GetEvent(&ev)) { ... }
+ *   }
+ * @{
+ */
+
+#ifndef LPC17XX_GPIOIN_H_
+#define LPC17XX_GPIOIN_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_tmrwheel.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup GPIOIN_Public_Macros GPIOIN Public Macros
+ * @{
+ */
+
+/** Number of pins that can be configured */
+#ifndef GPIOIN_MAX_PINS
+#define GPIOIN_MAX_PINS (8)
+#endif
+
+/** Event queue length, must be a power of two */
+#ifndef GPIOIN_QUEUE_SIZE
+#define GPIOIN_QUEUE_SIZE (16)
+#endif
+
+/** Report rising edges (pin went high) */
+#define GPIOIN_EDGE_RISING ((uint8_t)(1 << 0))
+/** Report falling edges (pin went low) */
+#define GPIOIN_EDGE_FALLING ((uint8_t)(1 << 1))
+/** Report both edges */
+#define GPIOIN_EDGE_BOTH (GPIOIN_EDGE_RISING | GPIOIN_EDGE_FALLING)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup GPIOIN_Private_Macros GPIOIN Private Macros
+ * @{
+ */
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check a pin with GPIO interrupts, P0.0-P0.30 or P2.0-P2.13 */
+#define PARAM_GPIOIN_PIN(port, pin) ((((port) == 0) && ((pin) <= 30)) || (((port) == 2) && ((pin) <= 13)))
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup GPIOIN_Public_Types GPIOIN Public Types
+     * @{
+     */
+
+    /**
+     * @brief Input pin configuration structure
+     */
+    typedef struct
+    {
+        uint8_t Portnum;     /**< Port number, 0 or 2 */
+        uint8_t Pinnum;      /**< Pin number, 0..30 on port 0, 0..13 on port 2 */
+        uint8_t Edges;       /**< Edges to report, GPIOIN_EDGE_x */
+        uint32_t DebounceUs; /**< Quiet time before the level is taken */
+    } GPIOIN_PIN_CFG_Type;
+
+    /**
+     * @brief Input event
+     */
+    typedef struct
+    {
+        uint32_t Timestamp; /**< Timer wheel counter at the first edge of the burst */
+        uint8_t Portnum;    /**< Port number */
+        uint8_t Pinnum;     /**< Pin number */
+        uint8_t Edge;       /**< GPIOIN_EDGE_RISING or GPIOIN_EDGE_FALLING */
+        uint8_t Bounces;    /**< Extra edges filtered out, saturates at 255 */
+    } GPIOIN_Event_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup GPIOIN_Public_Functions GPIOIN Public Functions
+     * @{
+     */
+
+    void GPIOIN_Init(void);
+    Status GPIOIN_ConfigPin(const GPIOIN_PIN_CFG_Type* GPIOINConfigStruct);
+    void GPIOIN_PinCmd(uint8_t portNum, uint8_t pinNum, FunctionalState NewState);
+    Bool GPIOIN_GetLevel(uint8_t portNum, uint8_t pinNum);
+    Bool GPIOIN_GetEvent(GPIOIN_Event_Type* event);
+    uint32_t GPIOIN_GetDropped(void);
+    void GPIOIN_IRQHandler(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_GPIOIN_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
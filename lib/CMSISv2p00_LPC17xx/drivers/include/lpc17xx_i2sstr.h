@@ -0,0 +1,158 @@
+/**********************************************************************
+ * $Id$		lpc17xx_i2sstr.h				2026-10-18
+ *//**
+* @file		lpc17xx_i2sstr.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for I2S audio streaming on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup I2SSTR I2SSTR (I2S DMA Streaming)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Streams I2S transmit and receive data through GPDMA ping-pong buffers.
+ * Each stream has one buffer in two halves, moved by two linked list items
+ * that point to each other; the channel never stops. When a half is done the
+ * stream callback gets it, from the GPDMA dispatcher GPDMA_IntHandler(), to
+ * refill (transmit) or to consume (receive) while the DMA works on the other
+ * half.
+ *
+ * The transmit stream uses I2S DMA1, the receive stream I2S DMA2, each with
+ * a FIFO depth of I2SSTR_FIFO_DEPTH words and DMA bursts of the same size,
+ * so a DMA request moves half a FIFO.
+ *
+ * The buffers hold I2S words for 16 bit stereo (I2S_CFG_Type wordwidth
+ * I2S_WORDWIDTH_16, mono I2S_STEREO): one word per frame, left channel in
+ * the low half word. Interleaved int16 stereo audio is already in this
+ * format; the pack and unpack functions convert it, or q15 mono, to and
+ * from the buffers two samples per word access.
+ *
+ * The stream structure holds the linked list items: it and the buffers
+ * must be in AHB SRAM (0x2007C000), the GPDMA cannot reach the local SRAM
+ * at 0x10000000.
+ *
+ * Usage:
+ *   void DMA_IRQHandler(void) { GPDMA_IntHandler(); }
+ *   ...
+ *   I2S_Init(LPC_I2S); I2S_Config(...); I2S_FreqConfig(LPC_I2S, 48000, I2S_TX_MODE);
+ *   GPDMA_Init();
+ *   I2SSTR_Init(&tx, &tx_cfg);
+ *   I2SSTR_Start(&tx);
+ *   I2S_Start(LPC_I2S);
+ * @{
+ */
+
+#ifndef LPC17XX_I2SSTR_H_
+#define LPC17XX_I2SSTR_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_gpdma.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup I2SSTR_Public_Macros I2SSTR Public Macros
+ * @{
+ */
+
+/** Most words in one half buffer */
+#define I2SSTR_MAX_HALF_WORDS (4095)
+/** FIFO level of the DMA requests, also the DMA burst size */
+#define I2SSTR_FIFO_DEPTH (4)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup I2SSTR_Private_Macros I2SSTR Private Macros
+ * @{
+ */
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check the half buffer length, a multiple of the burst size */
+#define PARAM_I2SSTR_WORDS(n) (((n) != 0) && ((n) <= I2SSTR_MAX_HALF_WORDS) && (((n) % I2SSTR_FIFO_DEPTH) == 0))
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup I2SSTR_Public_Types I2SSTR Public Types
+     * @{
+     */
+
+    /** Half buffer callback, called from the DMA interrupt */
+    typedef void (*I2SSTR_Callback)(uint32_t* half, uint32_t words, void* arg);
+
+    /**
+     * @brief Stream configuration structure
+     */
+    typedef struct
+    {
+        uint8_t Mode;             /**< I2S_TX_MODE or I2S_RX_MODE */
+        uint32_t* Buffer;         /**< 2 * Words I2S words, in AHB SRAM */
+        uint32_t Words;           /**< Words per half, a multiple of I2SSTR_FIFO_DEPTH */
+        I2SSTR_Callback Callback; /**< Called with each finished half, or NULL */
+        void* Arg;                /**< Passed to the callback */
+        uint32_t PrioClass;       /**< Channel priority class, GPDMA_PRIO_x */
+    } I2SSTR_CFG_Type;
+
+    /**
+     * @brief Stream, owned by the caller, in AHB SRAM
+     */
+    typedef struct
+    {
+        GPDMA_LLI_Type Lli[2];
+        LPC_GPDMACH_TypeDef* Channel;
+        uint32_t* Buffer;
+        uint32_t Words;
+        uint32_t Config;
+        I2SSTR_Callback Callback;
+        void* Arg;
+        volatile uint32_t Errors; /**< DMA error interrupts */
+        uint8_t ChannelNum;
+        uint8_t Mode;
+        volatile uint8_t Half; /**< Half the DMA is working on */
+    } I2SSTR_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup I2SSTR_Public_Functions I2SSTR Public Functions
+     * @{
+     */
+
+    Status I2SSTR_Init(I2SSTR_Type* stream, const I2SSTR_CFG_Type* I2SSTRConfigStruct);
+    void I2SSTR_DeInit(I2SSTR_Type* stream);
+    void I2SSTR_Start(I2SSTR_Type* stream);
+    void I2SSTR_Stop(I2SSTR_Type* stream);
+    void I2SSTR_PackStereo16(uint32_t* dst, const int16_t* src, uint32_t frames);
+    void I2SSTR_PackMono16(uint32_t* dst, const int16_t* src, uint32_t frames);
+    void I2SSTR_UnpackStereo16(int16_t* dst, const uint32_t* src, uint32_t frames);
+    void I2SSTR_UnpackMono16(int16_t* dst, const uint32_t* src, uint32_t frames);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_I2SSTR_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
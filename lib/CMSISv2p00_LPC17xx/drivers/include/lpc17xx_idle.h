@@ -0,0 +1,132 @@
+/**********************************************************************
+ * $Id$		lpc17xx_idle.h				2026-10-18
+ *//**
+* @file		lpc17xx_idle.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the tickless idle manager on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup IDLE IDLE (Tickless Idle Manager)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Replaces the empty while(1) spin of the main loop. IDLE_Enter() takes the
+ * next deadline from the timer wheel (TMRWHEEL) and the RTC alarm queue
+ * (RTCTS), and picks the deepest state whose wake-up latency still meets
+ * it:
+ * - Run: a timer is due sooner than the Sleep wake-up latency.
+ * - Sleep: the CPU clock stops, any interrupt (timer match, DMA completion,
+ *   ...) wakes it up. The timer match is brought forward by the Sleep
+ *   wake-up latency, so the timer interrupt still runs on its deadline.
+ * - Deep-sleep: all clocks stop, the RTC alarm wakes the CPU early by the
+ *   Deep-sleep wake-up latency. Only used when no DMA channel is enabled and
+ *   the deadline is at least DeepSleepMinUs away; the stopped timer counter
+ *   is then moved forward with the RTC, so timer deadlines still hold.
+ *
+ * Deep-sleep needs RTCTS: RTCTS_Init() called and RTC_IRQHandler() calling
+ * RTCTS_IRQHandler(). RTCTS owns the RTC interrupts; the idle manager takes
+ * its counter value at the RTC second boundary and wakes up on an RTCTS
+ * alarm, so the application uses the RTC alarm through RTCTS alarms only.
+ *
+ * Usage:
+ *   void RTC_IRQHandler(void) { RTCTS_IRQHandler(); }
+ *   ...
+ *   while (1) { TMRWHEEL_Dispatch(); RTCTS_Dispatch(); IDLE_Enter(); }
+ * @{
+ */
+
+#ifndef LPC17XX_IDLE_H_
+#define LPC17XX_IDLE_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup IDLE_Private_Macros IDLE Private Macros
+ * @{
+ */
+
+/** Longest Deep-sleep in seconds, the skipped ticks stay within half the
+ * 32 bit timer counter range at 25 MHz */
+#define IDLE_DEEPSLEEP_MAX_SEC (59)
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check an idle state */
+#define PARAM_IDLE_STATE(n) ((n) < IDLE_NUM_STATES)
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup IDLE_Public_Types IDLE Public Types
+     * @{
+     */
+
+    /**
+     * @brief Idle states
+     */
+    typedef enum
+    {
+        IDLE_STATE_RUN = 0,   /**< CPU kept running */
+        IDLE_STATE_SLEEP,     /**< Sleep mode */
+        IDLE_STATE_DEEPSLEEP, /**< Deep-sleep mode */
+        IDLE_NUM_STATES
+    } IDLE_STATE_Type;
+
+    /**
+     * @brief Idle manager configuration structure
+     */
+    typedef struct
+    {
+        uint32_t SleepLatencyUs;     /**< Wake-up time from Sleep to the interrupt
+                                          handler; the timer wakes the CPU this much
+                                          early, closer deadlines are not slept */
+        uint32_t DeepSleepLatencyUs; /**< Wake-up time from Deep-sleep, oscillator
+                                          start and PLL lock; the alarm is set this
+                                          much before the deadline */
+        uint32_t DeepSleepMinUs;     /**< Shortest idle time worth a Deep-sleep,
+                                          should be above 2 s, 0 disables Deep-sleep */
+        Bool (*WorkPending)(void);   /**< Optional, called with interrupts masked just
+                                          before sleeping, e.g. TASK_IsReady, so work
+                                          made ready by an interrupt is not slept on */
+    } IDLE_CFG_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup IDLE_Public_Functions IDLE Public Functions
+     * @{
+     */
+
+    void IDLE_Init(const IDLE_CFG_Type* IDLEConfigStruct);
+    IDLE_STATE_Type IDLE_Enter(void);
+    uint64_t IDLE_GetResidencyUs(IDLE_STATE_Type state);
+    uint32_t IDLE_GetEntryCount(IDLE_STATE_Type state);
+    void IDLE_ResetStats(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_IDLE_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
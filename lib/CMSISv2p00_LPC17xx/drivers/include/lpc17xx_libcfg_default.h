@@ -132,6 +132,57 @@
 /* EMAC ------------------------------ */
 #define _EMAC
 
+/* ADCMON ---------------------------- */
+#define _ADCMON
+
+/* FLASHKV --------------------------- */
+#define _FLASHKV
+
+/* BOOTPROF -------------------------- */
+#define _BOOTPROF
+
+/* TMRWHEEL -------------------------- */
+#define _TMRWHEEL
+
+/* IDLE ------------------------------ */
+#define _IDLE
+
+/* TASK ------------------------------ */
+#define _TASK
+
+/* GPIOIN ---------------------------- */
+#define _GPIOIN
+
+/* DMAPAT ---------------------------- */
+#define _DMAPAT
+
+/* RTCTS ---------------------------- */
+#define _RTCTS
+
+/* QEITRK ---------------------------- */
+#define _QEITRK
+
+/* MCCOMM ---------------------------- */
+#define _MCCOMM
+
+/* I2SSTR ---------------------------- */
+#define _I2SSTR
+
+/* DMAPACE --------------------------- */
+#define _DMAPACE
+
+/* DMACPY ---------------------------- */
+#define _DMACPY
+
+/* DDS ------------------------------- */
+#define _DDS
+
+/* ENVGEN ---------------------------- */
+#define _ENVGEN
+
+/* RAMFUNC --------------------------- */
+#define _RAMFUNC
+
 /************************** GLOBAL/PUBLIC MACRO DEFINITIONS *********************************/
 
 #ifdef DEBUG
@@ -0,0 +1,142 @@
+/**********************************************************************
+ * $Id$		lpc17xx_mccomm.h				2026-10-18
+ *//**
+* @file		lpc17xx_mccomm.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for batched MCPWM commutation on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup MCCOMM MCCOMM (MCPWM Batched Commutation)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Updates the limits and matches of all three MCPWM channels as one step.
+ * MCPWM_WriteToShadow() writes one channel at a time, so a period boundary
+ * between two calls runs a period with some phases updated and others not.
+ * MCCOMM_Write() sets the DISUP bits of the three channels, writes the six
+ * write registers (and the DC mode pattern), and clears the DISUP bits again
+ * with a single MCCON_CLR store: the functional registers of all channels
+ * then load together at the next period boundary, the limit in edge aligned
+ * mode and the zero crossing in center aligned mode.
+ *
+ * Steps are precomputed in a table (six-step patterns, SVPWM sectors or a
+ * sine table), so an update is a few stores. The table is either stepped
+ * from the channel 0 limit interrupt every given number of periods, or by
+ * the caller (e.g. from the hall sensor interrupt) with MCCOMM_Step().
+ *
+ * Use AC mode, or start the channels together with the same limit, so the
+ * three channels share the period boundary.
+ *
+ * Usage:
+ *   void MCPWM_IRQHandler(void) { MCCOMM_IRQHandler(); }
+ *   ...
+ *   MCPWM_Init(LPC_MCPWM);
+ *   MCCOMM_Init(&comm_cfg);
+ *   MCCOMM_TableStart(sine_steps, 48, 1);
+ *   MCPWM_Start(LPC_MCPWM, ENABLE, ENABLE, ENABLE);
+ * @{
+ */
+
+#ifndef LPC17XX_MCCOMM_H_
+#define LPC17XX_MCCOMM_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup MCCOMM_Public_Macros MCCOMM Public Macros
+ * @{
+ */
+
+/** Output modes */
+#define MCCOMM_MODE_INDEPENDENT (0) /**< Three independent channels */
+#define MCCOMM_MODE_AC (1)          /**< 3-phase AC, all channels use the channel 0 limit */
+#define MCCOMM_MODE_DC (2)          /**< 3-phase DC, MCOA0 routed by the step pattern */
+
+/** Maximum dead time, in MCPWM clocks */
+#define MCCOMM_MAX_DEADTIME (0x3FF)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup MCCOMM_Private_Macros MCCOMM Private Macros
+ * @{
+ */
+
+#define PARAM_MCCOMM_MODE(n) ((n == MCCOMM_MODE_INDEPENDENT) || (n == MCCOMM_MODE_AC) || (n == MCCOMM_MODE_DC))
+#define PARAM_MCCOMM_DEADTIME(n) (n <= MCCOMM_MAX_DEADTIME)
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup MCCOMM_Public_Types MCCOMM Public Types
+     * @{
+     */
+
+    /**
+     * @brief Commutation configuration structure, same for all three channels
+     */
+    typedef struct
+    {
+        uint8_t Mode;        /**< MCCOMM_MODE_x */
+        uint8_t Center;      /**< TRUE for center aligned, FALSE for edge aligned */
+        uint8_t PassiveHigh; /**< TRUE if the passive state of the outputs is HIGH */
+        uint8_t InvertB;     /**< DC mode: TRUE if MCOB is the inverse of MCOA */
+        uint16_t DeadTime;   /**< Dead time in MCPWM clocks, 0 disables it */
+    } MCCOMM_CFG_Type;
+
+    /**
+     * @brief One commutation step; the field order matches the MCPER0..2,
+     * MCPW0..2 registers
+     */
+    typedef struct
+    {
+        uint32_t Limit[3]; /**< Channel periods (MCPERn), only Limit[0] in AC mode */
+        uint32_t Match[3]; /**< Channel pulse widths (MCPWn), at most the limit */
+        uint32_t Pattern;  /**< DC mode outputs (MCPWM_CP_x ORed), 0 otherwise */
+    } MCCOMM_STEP_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup MCCOMM_Public_Functions MCCOMM Public Functions
+     * @{
+     */
+
+    void MCCOMM_Init(const MCCOMM_CFG_Type* MCCOMMConfigStruct);
+    void MCCOMM_Write(const MCCOMM_STEP_Type* step);
+    Status MCCOMM_TableStart(const MCCOMM_STEP_Type* table, uint32_t length, uint32_t periodsPerStep);
+    void MCCOMM_TableStop(void);
+    Status MCCOMM_Step(uint32_t index);
+    uint32_t MCCOMM_GetIndex(void);
+    void MCCOMM_IRQHandler(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_MCCOMM_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -125,6 +125,47 @@ extern "C"
 #define PINSEL_I2C_Normal_Mode ((0)) /**< The standard drive mode */
 #define PINSEL_I2C_Fast_Mode   ((1)) /**<  Fast Mode Plus drive mode */
 
+/***********************************************************************
+ * Macros to declare a pin map
+ *
+ * A pin map is declared from an X-macro list of
+ * X(port, pin, function, pinmode, opendrain) rows, where port and pin are
+ * plain decimal numbers:
+ *
+ *   #define ADC_PINS(X)                                                 \
+ *       X(0, 25, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL) \
+ *       X(1, 30, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL)
+ *   PINSEL_PINMAP_DEFINE(adc_pinmap, ADC_PINS)
+ *   ...
+ *   PINSEL_ConfigPinMap(adc_pinmap, NELEMENTS(adc_pinmap));
+ *
+ * Each row carries its register index and bit position, computed at compile
+ * time; PINSEL_ConfigPinMap() merges the rows of a map into one mask and
+ * value per register and writes each register it touches once.
+ *
+ * Every row also defines a global symbol PINSEL_Claim_P<port>_<pin>, so a
+ * pin used twice fails the build: in the same file at compile time, in
+ * different files at link time (multiple definition). The check has two
+ * limits:
+ * - the symbol is pasted from the port and pin tokens, so they must be
+ *   plain decimal literals: PINSEL_PIN_5 or an expression does not paste,
+ *   and 05 gives a symbol apart from 5, so that conflict goes unseen;
+ * - the symbols are definitions, so PINSEL_PINMAP_DEFINE belongs in one
+ *   source file. Used in a header included by two files, it reports a
+ *   conflict that is not there: share the list macro in the header, and
+ *   define the map once.
+ **********************************************************************/
+/** Expands a row to a PINSEL_PINMAP_Type initializer */
+#define PINSEL_PINMAP_ENTRY(port, pin, func, mode, od)                                                                \
+    {(uint8_t)(2 * (port) + ((pin) >> 4)), (uint8_t)(((pin)&0x0F) << 1), (uint8_t)(port), (uint8_t)(pin),              \
+     (uint8_t)(func), (uint8_t)(mode), (uint8_t)(od)},
+/** Expands a row to the claim symbol of its pin */
+#define PINSEL_PINMAP_CLAIM(port, pin, func, mode, od) const uint8_t PINSEL_Claim_P##port##_##pin = (func);
+/** Defines the pin map <name> and the claim symbols of its pins */
+#define PINSEL_PINMAP_DEFINE(name, LIST)                                                                              \
+    LIST(PINSEL_PINMAP_CLAIM)                                                                                         \
+    const PINSEL_PINMAP_Type name[] = {LIST(PINSEL_PINMAP_ENTRY)};
+
 /**
  * @}
  */
@@ -168,6 +209,18 @@ extern "C"
                            - PINSEL_PINMODE_OPENDRAIN: Pin is in the open drain mode */
     } PINSEL_CFG_Type;
 
+    /** @brief Pin map entry, register index and bit position precomputed */
+    typedef struct
+    {
+        uint8_t RegIdx;    /**< Index of the PINSELn/PINMODEn register, 2 * port + pin / 16 */
+        uint8_t Shift;     /**< Bit position of the pin in PINSELn/PINMODEn, 2 * (pin % 16) */
+        uint8_t Portnum;   /**< Port Number, 0 to 4 */
+        uint8_t Pinnum;    /**< Pin Number, 0 to 31 */
+        uint8_t Funcnum;   /**< Function Number, PINSEL_FUNC_x */
+        uint8_t Pinmode;   /**< Pin Mode, PINSEL_PINMODE_PULLUP/TRISTATE/PULLDOWN */
+        uint8_t OpenDrain; /**< PINSEL_PINMODE_NORMAL or PINSEL_PINMODE_OPENDRAIN */
+    } PINSEL_PINMAP_Type;
+
     /**
      * @}
      */
@@ -178,6 +231,7 @@ extern "C"
      */
 
     void PINSEL_ConfigPin(PINSEL_CFG_Type* PinCfg);
+    void PINSEL_ConfigPinMap(const PINSEL_PINMAP_Type* PinMap, uint32_t NumPins);
     void PINSEL_ConfigTraceFunc(FunctionalState NewState);
     void PINSEL_SetI2C0Pins(uint8_t i2cPinMode, FunctionalState filterSlewRateEnable);
 
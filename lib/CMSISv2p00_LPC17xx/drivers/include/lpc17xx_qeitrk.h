@@ -0,0 +1,116 @@
+/**********************************************************************
+ * $Id$		lpc17xx_qeitrk.h				2026-10-18
+ *//**
+* @file		lpc17xx_qeitrk.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the QEI position/velocity tracker on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup QEITRK QEITRK (QEI Position/Velocity Tracker)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Tracks the encoder position and velocity with an alpha-beta filter run
+ * from the QEI velocity timer interrupt, once per velocity period:
+ *
+ *   predicted = position + velocity
+ *   residual  = measured - predicted
+ *   position  = predicted + alpha * residual
+ *   velocity  = velocity + beta * residual
+ *
+ * Position is kept in encoder counts and velocity in counts per velocity
+ * period, both as Q16 fixed point; alpha and beta are Q16 fractions. The
+ * counts to RPM scale factor is computed once by QEITRK_Init(), so the
+ * interrupt and the RPM getters use only multiplies and shifts, no
+ * division and no CLKPWR_GetPCLK().
+ *
+ * A critically damped choice is beta = alpha^2 / (2 - alpha); for example
+ * alpha 0.5 (32768) and beta 0.167 (10923). Smaller gains filter more and
+ * respond slower.
+ *
+ * Usage:
+ *   void QEI_IRQHandler(void) { QEITRK_IRQHandler(); }
+ *   ...
+ *   QEI_Init(LPC_QEI, &qei_cfg);
+ *   QEITRK_Init(&trk_cfg);
+ *   ...
+ *   rpm = QEITRK_GetRpm() >> QEITRK_RPM_FRAC_BITS;
+ * @{
+ */
+
+#ifndef LPC17XX_QEITRK_H_
+#define LPC17XX_QEITRK_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup QEITRK_Public_Macros QEITRK Public Macros
+ * @{
+ */
+
+/** Fraction bits of the RPM values */
+#define QEITRK_RPM_FRAC_BITS (8)
+/** Fraction bits of the position, velocity and gains */
+#define QEITRK_FRAC_BITS (16)
+
+/**
+ * @}
+ */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup QEITRK_Public_Types QEITRK Public Types
+     * @{
+     */
+
+    /**
+     * @brief Tracker configuration structure
+     */
+    typedef struct
+    {
+        uint32_t PPR;      /**< Encoder pulses per revolution */
+        uint32_t PeriodUs; /**< Velocity timer period, the filter update rate */
+        uint32_t Alpha;    /**< Position gain, Q16, 1..65535 */
+        uint32_t Beta;     /**< Velocity gain, Q16, 1..65535 */
+    } QEITRK_CFG_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup QEITRK_Public_Functions QEITRK Public Functions
+     * @{
+     */
+
+    void QEITRK_Init(const QEITRK_CFG_Type* QEITRKConfigStruct);
+    void QEITRK_IRQHandler(void);
+    int32_t QEITRK_GetPosition(void);
+    int32_t QEITRK_GetVelocity(void);
+    int32_t QEITRK_GetRpm(void);
+    int32_t QEITRK_GetRawRpm(void);
+    uint32_t QEITRK_GetUpdates(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_QEITRK_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
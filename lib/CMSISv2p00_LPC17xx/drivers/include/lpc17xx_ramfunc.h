@@ -0,0 +1,138 @@
+/**********************************************************************
+ * $Id$		lpc17xx_ramfunc.h				2026-10-18
+ *//**
+* @file		lpc17xx_ramfunc.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for RAM-resident code and flash accelerator tuning
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup RAMFUNC RAMFUNC (RAM-resident Code and Flash Tuning)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Code in flash is fetched through the flash accelerator, with FLASHTIM
+ * wait states on every miss of its line buffers, typically on a taken
+ * branch. Code in local SRAM has no wait states. Functions marked
+ * SECTION_RAMFUNC (lpc17xx_section.h) are copied there at reset.
+ *
+ * RAMFUNC_RelocateVectors() copies the vector table to local SRAM and
+ * points VTOR at it, so the exception vector fetch does not touch the
+ * flash either, and handlers can be swapped at run time with
+ * RAMFUNC_SetHandler(). The reset handler does it before main() when
+ * built with __RAM_VECTORS defined.
+ *
+ * The flash access time is FLASHTIM + 1 CPU clocks. SystemInit() sets it
+ * from FLASHCFG_Val; RAMFUNC_MinFlashTiming() gives the smallest setting
+ * allowed at a clock frequency, RAMFUNC_SetFlashTiming() changes it.
+ *
+ * Benchmark mode: RAMFUNC_MeasureIRQ() times an interrupt, from being
+ * pended to its return, with the DWT cycle counter, and
+ * RAMFUNC_SweepFlashTiming() repeats this for every allowed FLASHTIM.
+ * Swapping the handler between a flash and a RAM build of the same code
+ * compares the two. The handler must accept being called with no event
+ * pending.
+ *
+ * Usage:
+ *   static inline void kernel(void) { ... }
+ *   void dac_isr_flash(void) { kernel(); }
+ *   SECTION_RAMFUNC void dac_isr_ram(void) { kernel(); }
+ *   ...
+ *   RAMFUNC_RelocateVectors();
+ *   NVIC_EnableIRQ(TIMER0_IRQn);
+ *   RAMFUNC_SetHandler(TIMER0_IRQn, dac_isr_flash);
+ *   RAMFUNC_SweepFlashTiming(TIMER0_IRQn, 100, flash_cycles);
+ *   RAMFUNC_SetHandler(TIMER0_IRQn, dac_isr_ram);
+ *   RAMFUNC_SweepFlashTiming(TIMER0_IRQn, 100, ram_cycles);
+ * @{
+ */
+
+#ifndef LPC17XX_RAMFUNC_H_
+#define LPC17XX_RAMFUNC_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_section.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup RAMFUNC_Public_Macros RAMFUNC Public Macros
+ * @{
+ */
+
+/** Vector table entries: 16 system exceptions and 33 interrupts */
+#define RAMFUNC_VECTORS (16 + 33)
+/** FLASHTIM settings, 1 to 6 CPU clocks */
+#define RAMFUNC_FLASHTIM_COUNT (6)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup RAMFUNC_Private_Macros RAMFUNC Private Macros
+ * @{
+ */
+
+/* --------------------- BIT DEFINITIONS -------------------------------------- */
+/** FLASHCFG flash access time field */
+#define RAMFUNC_FLASHCFG_FLASHTIM_Pos (12)
+#define RAMFUNC_FLASHCFG_FLASHTIM_Msk ((uint32_t)(0xF << RAMFUNC_FLASHCFG_FLASHTIM_Pos))
+/** VTOR alignment, the table size rounded up to a power of two */
+#define RAMFUNC_VECTOR_ALIGN (256)
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check a FLASHTIM setting */
+#define PARAM_RAMFUNC_FLASHTIM(n) ((n) < RAMFUNC_FLASHTIM_COUNT)
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup RAMFUNC_Public_Types RAMFUNC Public Types
+     * @{
+     */
+
+    /** Exception handler */
+    typedef void (*RAMFUNC_Handler)(void);
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup RAMFUNC_Public_Functions RAMFUNC Public Functions
+     * @{
+     */
+
+    void RAMFUNC_RelocateVectors(void);
+    void RAMFUNC_SetHandler(IRQn_Type IRQn, RAMFUNC_Handler handler);
+    uint32_t RAMFUNC_GetFlashTiming(void);
+    void RAMFUNC_SetFlashTiming(uint32_t flashtim);
+    uint32_t RAMFUNC_MinFlashTiming(uint32_t cclk);
+    uint32_t RAMFUNC_MeasureIRQ(IRQn_Type IRQn, uint32_t runs);
+    void RAMFUNC_SweepFlashTiming(IRQn_Type IRQn, uint32_t runs, uint32_t* cycles);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_RAMFUNC_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,347 @@
+/**********************************************************************
+ * $Id$		lpc17xx_ringbuf.h				2026-10-18
+ *//**
+* @file		lpc17xx_ringbuf.h
+* @brief	Header-only ring buffers and sample history filters:
+* 			power-of-two ring buffers, running-sum moving average,
+* 			exponential average and windowed min/max
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Library group ----------------------------------------------------------- */
+/** @defgroup RINGBUF RINGBUF (Ring Buffers and Sample Histories)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * All containers are declared for a given element type and a power-of-two
+ * size, so indexing is a mask instead of a compare-and-wrap. Each container
+ * has a single producer: one context (typically an ISR) pushes.
+ *
+ * Ring buffers also have a single consumer, which may run in another
+ * context. Indices are free-running, the producer only writes Head and the
+ * consumer only writes Tail. Elements are accessed through volatile lvalues,
+ * so the compiler keeps them in order with the index that hands them over,
+ * and a DMB keeps the core from reordering them; the other side never sees
+ * an index ahead of the data.
+ *
+ * MAVG and WINMINMAX histories update several fields per Push (a 64-bit
+ * sum is itself two words), so they are read in the producer context. A
+ * reader in another context must mask the producer around the read, e.g.
+ * with __disable_irq() / __set_PRIMASK().
+ *
+ * Example, history of the last 32 samples of ADC channel 2:
+ * @code
+ * MAVG_DECLARE(Canal2, uint16_t, uint32_t, 32)
+ * static Canal2_Type canal_2;
+ *
+ * Canal2_Init(&canal_2);              // once
+ * Canal2_Push(&canal_2, valor);       // in the ADC ISR, O(1)
+ * promedio = Canal2_Average(&canal_2) // in the ADC ISR, O(1)
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_RINGBUF_H_
+#define LPC17XX_RINGBUF_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup RINGBUF_Public_Macros RINGBUF Public Macros
+ * @{
+ */
+
+/** Evaluates to 1 if n is a non-zero power of two */
+#define RINGBUF_IS_POW2(n) (((n) != 0) && (((n) & ((n) - 1)) == 0))
+
+/** Compile-time check that a size is a power of two (negative array size otherwise) */
+#define RINGBUF_ASSERT_POW2(name, n) typedef char name##_size_must_be_power_of_two[RINGBUF_IS_POW2(n) ? 1 : -1]
+
+/*******************************************************************************
+ * @brief		Declare a ring buffer type <name>_Type of <size> elements of
+ * 				<type>, and its functions:
+ * 					- <name>_Init(rb)
+ * 					- <name>_Put(rb, v): append, returns ERROR if full
+ * 					- <name>_Get(rb, &v): remove oldest, returns ERROR if empty
+ * 					- <name>_Count(rb), <name>_IsFull(rb)
+ * 					- <name>_Peek(rb, i): i-th oldest element, i < Count
+ * 				Single producer (Put) / single consumer (Get).
+ *******************************************************************************/
+#define RINGBUF_DECLARE(name, type, size)                                                                             \
+    RINGBUF_ASSERT_POW2(name, size);                                                                                  \
+    typedef struct                                                                                                    \
+    {                                                                                                                 \
+        type Data[size];                                                                                              \
+        volatile uint32_t Head; /* written by producer only */                                                       \
+        volatile uint32_t Tail; /* written by consumer only */                                                       \
+    } name##_Type;                                                                                                    \
+    static inline void name##_Init(name##_Type* rb)                                                                   \
+    {                                                                                                                 \
+        rb->Head = 0;                                                                                                 \
+        rb->Tail = 0;                                                                                                 \
+    }                                                                                                                 \
+    static inline uint32_t name##_Count(const name##_Type* rb)                                                        \
+    {                                                                                                                 \
+        return rb->Head - rb->Tail;                                                                                   \
+    }                                                                                                                 \
+    static inline Bool name##_IsFull(const name##_Type* rb)                                                           \
+    {                                                                                                                 \
+        return (rb->Head - rb->Tail) == (size) ? TRUE : FALSE;                                                        \
+    }                                                                                                                 \
+    static inline Status name##_Put(name##_Type* rb, type value)                                                      \
+    {                                                                                                                 \
+        uint32_t head = rb->Head;                                                                                     \
+        if ((head - rb->Tail) == (size))                                                                              \
+        {                                                                                                             \
+            return ERROR;                                                                                             \
+        }                                                                                                             \
+        *(volatile type*)&rb->Data[head & ((size) - 1)] = value;                                                      \
+        /* The element must be stored before the consumer can see it */                                               \
+        __DMB();                                                                                                      \
+        rb->Head = head + 1;                                                                                          \
+        return SUCCESS;                                                                                               \
+    }                                                                                                                 \
+    static inline Status name##_Get(name##_Type* rb, type* value)                                                     \
+    {                                                                                                                 \
+        uint32_t tail = rb->Tail;                                                                                     \
+        if (rb->Head == tail)                                                                                         \
+        {                                                                                                             \
+            return ERROR;                                                                                             \
+        }                                                                                                             \
+        /* Read the element only after Head showed it, and before Tail frees it */                                    \
+        __DMB();                                                                                                      \
+        *value = *(volatile type*)&rb->Data[tail & ((size) - 1)];                                                     \
+        __DMB();                                                                                                      \
+        rb->Tail = tail + 1;                                                                                          \
+        return SUCCESS;                                                                                               \
+    }                                                                                                                 \
+    static inline type name##_Peek(const name##_Type* rb, uint32_t index)                                             \
+    {                                                                                                                 \
+        return *(const volatile type*)&rb->Data[(rb->Tail + index) & ((size) - 1)];                                   \
+    }
+
+/*******************************************************************************
+ * @brief		Declare a sample history <name>_Type of the last <size> values
+ * 				of <type>, with a running sum in <acc_type>. The oldest sample
+ * 				is overwritten, so the history never fills up. Functions:
+ * 					- <name>_Init(h)
+ * 					- <name>_Push(h, v): O(1), updates the running sum
+ * 					- <name>_Average(h): sum / number of samples held
+ * 					- <name>_Sum(h), <name>_Count(h)
+ * 					- <name>_Last(h, i): i-th newest sample, i < Count
+ * 				<acc_type> must hold size * max(type) without overflow.
+ * 				Read in the producer context, or with the producer masked.
+ *******************************************************************************/
+#define MAVG_DECLARE(name, type, acc_type, size)                                                                      \
+    RINGBUF_ASSERT_POW2(name, size);                                                                                  \
+    typedef struct                                                                                                    \
+    {                                                                                                                 \
+        type Data[size];                                                                                              \
+        acc_type Sum;                                                                                                 \
+        uint32_t Index;                                                                                               \
+        uint32_t Count;                                                                                               \
+    } name##_Type;                                                                                                    \
+    static inline void name##_Init(name##_Type* h)                                                                    \
+    {                                                                                                                 \
+        uint32_t i;                                                                                                   \
+        for (i = 0; i < (size); i++)                                                                                  \
+        {                                                                                                             \
+            h->Data[i] = 0;                                                                                           \
+        }                                                                                                             \
+        h->Sum = 0;                                                                                                   \
+        h->Index = 0;                                                                                                 \
+        h->Count = 0;                                                                                                 \
+    }                                                                                                                 \
+    static inline void name##_Push(name##_Type* h, type value)                                                        \
+    {                                                                                                                 \
+        uint32_t idx = h->Index;                                                                                      \
+        /* Unused slots hold 0, so subtracting the evicted sample is always valid */                                 \
+        h->Sum = h->Sum - h->Data[idx] + value;                                                                       \
+        h->Data[idx] = value;                                                                                         \
+        h->Index = (idx + 1) & ((size) - 1);                                                                          \
+        if (h->Count < (size))                                                                                        \
+        {                                                                                                             \
+            h->Count++;                                                                                               \
+        }                                                                                                             \
+    }                                                                                                                 \
+    static inline acc_type name##_Sum(const name##_Type* h)                                                           \
+    {                                                                                                                 \
+        return h->Sum;                                                                                                \
+    }                                                                                                                 \
+    static inline uint32_t name##_Count(const name##_Type* h)                                                         \
+    {                                                                                                                 \
+        return h->Count;                                                                                              \
+    }                                                                                                                 \
+    static inline acc_type name##_Average(const name##_Type* h)                                                       \
+    {                                                                                                                 \
+        /* Full history divides by a power-of-two constant */                                                        \
+        if (h->Count == (size))                                                                                       \
+        {                                                                                                             \
+            return h->Sum / (size);                                                                                   \
+        }                                                                                                             \
+        return (h->Count == 0) ? 0 : h->Sum / h->Count;                                                               \
+    }                                                                                                                 \
+    static inline type name##_Last(const name##_Type* h, uint32_t index)                                              \
+    {                                                                                                                 \
+        return h->Data[(h->Index - 1 - index) & ((size) - 1)];                                                        \
+    }
+
+/*******************************************************************************
+ * @brief		Declare a sliding-window min/max tracker <name>_Type over the
+ * 				last <size> values of <type>, using two monotonic deques.
+ * 				Push is amortized O(1), Min/Max are O(1). Functions:
+ * 					- <name>_Init(w)
+ * 					- <name>_Push(w, v)
+ * 					- <name>_Min(w), <name>_Max(w): valid after the first Push
+ * 				Read in the producer context, or with the producer masked.
+ *******************************************************************************/
+#define WINMINMAX_DECLARE(name, type, size)                                                                           \
+    RINGBUF_ASSERT_POW2(name, size);                                                                                  \
+    typedef struct                                                                                                    \
+    {                                                                                                                 \
+        type MinVal[size];                                                                                            \
+        uint32_t MinSeq[size];                                                                                        \
+        type MaxVal[size];                                                                                            \
+        uint32_t MaxSeq[size];                                                                                        \
+        uint32_t MinHead, MinTail; /* deque of increasing values */                                                  \
+        uint32_t MaxHead, MaxTail; /* deque of decreasing values */                                                  \
+        uint32_t Seq;              /* number of samples pushed */                                                    \
+    } name##_Type;                                                                                                    \
+    static inline void name##_Init(name##_Type* w)                                                                    \
+    {                                                                                                                 \
+        w->MinHead = w->MinTail = 0;                                                                                  \
+        w->MaxHead = w->MaxTail = 0;                                                                                  \
+        w->Seq = 0;                                                                                                   \
+    }                                                                                                                 \
+    static inline void name##_Push(name##_Type* w, type value)                                                        \
+    {                                                                                                                 \
+        uint32_t seq = w->Seq++;                                                                                      \
+        /* Drop samples that can no longer be the extreme */                                                         \
+        while ((w->MinTail != w->MinHead) && (w->MinVal[(w->MinTail - 1) & ((size) - 1)] >= value))                   \
+        {                                                                                                             \
+            w->MinTail--;                                                                                             \
+        }                                                                                                             \
+        while ((w->MaxTail != w->MaxHead) && (w->MaxVal[(w->MaxTail - 1) & ((size) - 1)] <= value))                   \
+        {                                                                                                             \
+            w->MaxTail--;                                                                                             \
+        }                                                                                                             \
+        /* Drop samples that left the window */                                                                      \
+        if ((w->MinTail != w->MinHead) && (seq - w->MinSeq[w->MinHead & ((size) - 1)] >= (size)))                     \
+        {                                                                                                             \
+            w->MinHead++;                                                                                             \
+        }                                                                                                             \
+        if ((w->MaxTail != w->MaxHead) && (seq - w->MaxSeq[w->MaxHead & ((size) - 1)] >= (size)))                     \
+        {                                                                                                             \
+            w->MaxHead++;                                                                                             \
+        }                                                                                                             \
+        w->MinVal[w->MinTail & ((size) - 1)] = value;                                                                 \
+        w->MinSeq[w->MinTail & ((size) - 1)] = seq;                                                                   \
+        w->MinTail++;                                                                                                 \
+        w->MaxVal[w->MaxTail & ((size) - 1)] = value;                                                                 \
+        w->MaxSeq[w->MaxTail & ((size) - 1)] = seq;                                                                   \
+        w->MaxTail++;                                                                                                 \
+    }                                                                                                                 \
+    static inline type name##_Min(const name##_Type* w)                                                               \
+    {                                                                                                                 \
+        return w->MinVal[w->MinHead & ((size) - 1)];                                                                  \
+    }                                                                                                                 \
+    static inline type name##_Max(const name##_Type* w)                                                               \
+    {                                                                                                                 \
+        return w->MaxVal[w->MaxHead & ((size) - 1)];                                                                  \
+    }
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup RINGBUF_Public_Types RINGBUF Public Types
+ * @{
+ */
+
+/**
+ * @brief Integer exponential moving average, alpha = 1 / 2^Shift
+ *
+ * Acc holds the average scaled by 2^Shift, so no precision is lost
+ * between updates and no division is needed.
+ */
+typedef struct
+{
+    int32_t Acc;   /**< Average << Shift */
+    uint8_t Shift; /**< Smoothing factor, alpha = 1 / 2^Shift */
+    uint8_t Primed; /**< 0 until the first sample is pushed */
+} EMA_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup RINGBUF_Public_Functions RINGBUF Public Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize an exponential moving average
+ * @param[in]	ema Pointer to EMA_Type
+ * @param[in]	shift Smoothing factor, alpha = 1 / 2^shift, should be <= 15
+ * @return		None
+ *******************************************************************************/
+static inline void EMA_Init(EMA_Type* ema, uint8_t shift)
+{
+    ema->Acc = 0;
+    ema->Shift = shift;
+    ema->Primed = 0;
+}
+
+/*******************************************************************************
+ * @brief		Push a sample into an exponential moving average. The first
+ * 				sample initializes the average to avoid a slow start from 0.
+ * @param[in]	ema Pointer to EMA_Type
+ * @param[in]	value New sample, |value| < 2^(31 - Shift)
+ * @return		None
+ *******************************************************************************/
+static inline void EMA_Push(EMA_Type* ema, int32_t value)
+{
+    if (!ema->Primed)
+    {
+        /* Multiply, a left shift of a negative value is undefined */
+        ema->Acc = value * (1 << ema->Shift);
+        ema->Primed = 1;
+        return;
+    }
+    ema->Acc += value - (ema->Acc >> ema->Shift);
+}
+
+/*******************************************************************************
+ * @brief		Get the current value of an exponential moving average
+ * @param[in]	ema Pointer to EMA_Type
+ * @return		Average value
+ *******************************************************************************/
+static inline int32_t EMA_Get(const EMA_Type* ema)
+{
+    return ema->Acc >> ema->Shift;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_RINGBUF_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -66,6 +66,12 @@ extern "C"
 /** Set timer enable */
 #define RIT_CTRL_TEN ((uint32_t)_BIT(3))
 
+/** Bit positions of the control register bits, for bit-band access */
+#define RIT_CTRL_INTEN_POS (0)
+#define RIT_CTRL_ENCLR_POS (1)
+#define RIT_CTRL_ENBR_POS (2)
+#define RIT_CTRL_TEN_POS (3)
+
 /** Macro to determine if it is valid RIT peripheral */
 #define PARAM_RITx(n) (((uint32_t*)n) == ((uint32_t*)LPC_RIT))
     /**
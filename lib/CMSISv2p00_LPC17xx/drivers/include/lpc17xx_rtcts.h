@@ -0,0 +1,129 @@
+/**********************************************************************
+ * $Id$		lpc17xx_rtcts.h				2026-10-18
+ *//**
+* @file		lpc17xx_rtcts.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for RTC timestamps and alarms on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup RTCTS RTCTS (RTC Timestamps and Alarm Queue)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Timestamps in microseconds since 1970-01-01 00:00:00 of the RTC time. The
+ * seconds come from the consolidated time registers CTIME0/CTIME1, read in
+ * one consistent pass; the microseconds from the timer wheel counter
+ * (TMRWHEEL), latched by the RTC counter increment interrupt at every
+ * second boundary. Timestamps never go backwards.
+ *
+ * Any number of alarms, each with its own callback, share the single RTC
+ * alarm: they are kept sorted by time and the alarm registers hold the
+ * earliest one. Alarms have a resolution of one second (use TMRWHEEL for
+ * shorter times); expired alarms are queued by RTCTS_IRQHandler() and their
+ * callbacks run from RTCTS_Dispatch(), called from the main loop.
+ *
+ * RTCTS owns the RTC interrupts and alarm registers for the whole
+ * firmware: the idle manager (IDLE) takes its second boundary sync with
+ * RTCTS_GetSync(), wakes up from Deep-sleep on an RTCTS alarm and treats
+ * the earliest alarm (RTCTS_GetNextAlarm()) as a deadline.
+ *
+ * Usage:
+ *   void RTC_IRQHandler(void) { RTCTS_IRQHandler(); }
+ *   ...
+ *   TMRWHEEL_Init(&cfg);
+ *   RTCTS_Init();
+ *   RTCTS_AlarmInit(&log_alarm, log_flush, NULL);
+ *   RTCTS_AlarmStart(&log_alarm, RTCTS_GetSeconds() + 60);
+ *   while (1) { RTCTS_Dispatch(); ... stamp = RTCTS_Now(); ... }
+ * @{
+ */
+
+#ifndef LPC17XX_RTCTS_H_
+#define LPC17XX_RTCTS_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_rtc.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup RTCTS_Private_Macros RTCTS Private Macros
+ * @{
+ */
+
+/** Alarm states */
+#define RTCTS_ALARM_IDLE (0)    /**< Not started, expired and dispatched, or cancelled */
+#define RTCTS_ALARM_PENDING (1) /**< In the sorted alarm list */
+#define RTCTS_ALARM_READY (2)   /**< Expired, waiting for RTCTS_Dispatch() */
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup RTCTS_Public_Types RTCTS Public Types
+     * @{
+     */
+
+    /** Alarm callback */
+    typedef void (*RTCTS_Callback)(void* arg);
+
+    /**
+     * @brief Alarm, owned by the caller, must stay valid while started
+     */
+    typedef struct RTCTS_Alarm
+    {
+        struct RTCTS_Alarm* Next;
+        uint32_t Time; /**< Seconds since 1970-01-01 */
+        RTCTS_Callback Callback;
+        void* Arg;
+        volatile uint8_t State; /**< RTCTS_ALARM_x */
+    } RTCTS_Alarm_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup RTCTS_Public_Functions RTCTS Public Functions
+     * @{
+     */
+
+    void RTCTS_Init(void);
+    uint64_t RTCTS_Now(void);
+    uint32_t RTCTS_GetSeconds(void);
+    Bool RTCTS_GetSync(uint32_t* tc, uint32_t* seconds);
+    void RTCTS_Suspend(void);
+    void RTCTS_Resume(void);
+    uint32_t RTCTS_ToSeconds(const RTC_TIME_Type* pFullTime);
+    void RTCTS_FromSeconds(uint32_t seconds, RTC_TIME_Type* pFullTime);
+    void RTCTS_AlarmInit(RTCTS_Alarm_Type* alarm, RTCTS_Callback callback, void* arg);
+    void RTCTS_AlarmStart(RTCTS_Alarm_Type* alarm, uint32_t seconds);
+    void RTCTS_AlarmCancel(RTCTS_Alarm_Type* alarm);
+    Bool RTCTS_AlarmIsActive(const RTCTS_Alarm_Type* alarm);
+    Bool RTCTS_GetNextAlarm(uint32_t* seconds);
+    void RTCTS_IRQHandler(void);
+    uint32_t RTCTS_Dispatch(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_RTCTS_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,105 @@
+/**********************************************************************
+ * $Id$		lpc17xx_section.h				2026-10-18
+ *//**
+* @file		lpc17xx_section.h
+* @brief	Header-only memory placement of data in the LPC17xx SRAM banks
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Library group ----------------------------------------------------------- */
+/** @defgroup SECTION SECTION (Memory Placement Sections)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * The LPC17xx SRAM is three blocks on separate slave ports of the AHB
+ * matrix, so masters using different blocks never wait for each other:
+ * - local SRAM, 32 kB at 0x10000000: on the CPU buses only, the DMA
+ *   controllers cannot reach it;
+ * - AHB SRAM bank 0, 16 kB at 0x2007C000;
+ * - AHB SRAM bank 1, 16 kB at 0x20080000.
+ *
+ * The linker script src/LPC17xx.ld keeps the stack and all unmarked data
+ * (.data, .bss) in local SRAM, for the CPU alone, and gives each AHB bank
+ * to one DMA master:
+ * - SECTION_DMA: GPDMA buffers and linked list items, in bank 0;
+ * - SECTION_EMAC: Ethernet descriptors and frame buffers, in bank 1.
+ *
+ * Then a GPDMA stream, Ethernet traffic and the CPU working on its own
+ * data each have a slave port to themselves; DMACPY_MeasureStall() shows
+ * the difference on the target, with the CPU data in bank 0 and in .bss:
+ * @code
+ * SECTION_DMA static uint32_t scratch[2048];
+ * SECTION_DMA static uint32_t shared[256];
+ * static uint32_t local[256];
+ * same = DMACPY_MeasureStall(scratch, sizeof(scratch), shared, 256);
+ * apart = DMACPY_MeasureStall(scratch, sizeof(scratch), local, 256);
+ * @endcode
+ * Both AHB sections are NOLOAD: they are not zeroed at reset and cannot
+ * have initializers, the driver owning a buffer sets it up.
+ *
+ * SECTION_RAMFUNC puts a function in local SRAM, where it runs without
+ * flash wait states: the linker script stores it in flash along with the
+ * .data initializers, and the reset handler copies it with them. Use it
+ * for interrupt handlers and short kernels run at a high rate; calls from
+ * it back to flash are long calls, so keep them out of the inner loop.
+ *
+ * Example:
+ * @code
+ * SECTION_DMA static uint32_t dds_buffer[2 * 256];
+ * SECTION_DMA static GPDMA_LLI_Type dds_lli[2];
+ * SECTION_RAMFUNC void TIMER0_IRQHandler(void) { ... }
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_SECTION_H_
+#define LPC17XX_SECTION_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup SECTION_Public_Macros SECTION Public Macros
+ * @{
+ */
+
+/** Section names, as used by the linker script */
+#define SECTION_NAME_DMA ".ahbsram0"
+#define SECTION_NAME_EMAC ".ahbsram1"
+#define SECTION_NAME_RAMFUNC ".ramfunc"
+#define SECTION_NAME_RAMVECTORS ".ramvectors"
+
+/** SECTION_DMA places the definition it starts in AHB SRAM bank 0, for the
+ * GPDMA; SECTION_EMAC in bank 1, for the Ethernet DMA; SECTION_RAMFUNC
+ * places a function in local SRAM, copied there at reset */
+#if defined(__CC_ARM)
+#define SECTION_DMA __attribute__((section(SECTION_NAME_DMA), zero_init))
+#define SECTION_EMAC __attribute__((section(SECTION_NAME_EMAC), zero_init))
+#define SECTION_RAMFUNC __attribute__((section(SECTION_NAME_RAMFUNC), noinline))
+#elif defined(__ICCARM__)
+#define SECTION_DMA _Pragma("location=\".ahbsram0\"") __no_init
+#define SECTION_EMAC _Pragma("location=\".ahbsram1\"") __no_init
+#define SECTION_RAMFUNC __ramfunc
+#else
+#define SECTION_DMA __attribute__((section(SECTION_NAME_DMA)))
+#define SECTION_EMAC __attribute__((section(SECTION_NAME_EMAC)))
+#define SECTION_RAMFUNC __attribute__((section(SECTION_NAME_RAMFUNC), long_call, noinline))
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_SECTION_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
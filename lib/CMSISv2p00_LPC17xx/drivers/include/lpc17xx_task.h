@@ -0,0 +1,213 @@
+/**********************************************************************
+ * $Id$		lpc17xx_task.h				2026-10-18
+ *//**
+* @file		lpc17xx_task.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the cooperative task runtime on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup TASK TASK (Cooperative Task Runtime)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Stackless tasks in the protothread style: a task is a function that
+ * returns at every wait point and resumes there on its next run, so all
+ * tasks share the main stack. Local variables are not kept across a wait,
+ * task state belongs in a structure reached through the task argument.
+ *
+ * A waiting task is not run again until it is woken: by its timer (timer
+ * wheel, TMRWHEEL) or by a TASK_Event_Type signalled from an interrupt
+ * handler, e.g. DMA completion, UART receive or an EXTI edge.
+ *
+ * Usage:
+ *   TASK_Event_Type adc_done = TASK_EVENT_INIT;
+ *   void ADC_IRQHandler(void) { ...; TASK_EventSignal(&adc_done); }
+ *
+ *   TASK_RESULT_Type sampler(TASK_Type* t)
+ *   {
+ *       TASK_BEGIN(t);
+ *       for (;;)
+ *       {
+ *           ADC_StartCmd(LPC_ADC, ADC_START_NOW);
+ *           TASK_AWAIT_EVENT(t, &adc_done);
+ *           ...
+ *           TASK_SLEEP(t, TMRWHEEL_UsToTicks(1000));
+ *       }
+ *       TASK_END(t);
+ *   }
+ *
+ *   TASK_Start(&sampler_task, sampler, NULL);
+ *   while (1) { if (TASK_Run() == 0) IDLE_Enter(); }
+ * @{
+ */
+
+#ifndef LPC17XX_TASK_H_
+#define LPC17XX_TASK_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "lpc17xx_tmrwheel.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup TASK_Public_Macros TASK Public Macros
+ * @{
+ */
+
+/** Event initializer, no signal pending */
+#define TASK_EVENT_INIT {0, NULL}
+
+/** Start of a task body, nothing but declarations may come before it */
+#define TASK_BEGIN(task)                                                                                               \
+    switch ((task)->Lc)                                                                                                \
+    {                                                                                                                  \
+        case 0:
+
+/** End of a task body, the task is done when it gets here */
+#define TASK_END(task)                                                                                                 \
+    }                                                                                                                  \
+    (task)->Lc = 0;                                                                                                    \
+    return TASK_DONE
+
+/** Let the other ready tasks run, then continue */
+#define TASK_YIELD(task)                                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (task)->Lc = __LINE__;                                                                                         \
+        return TASK_YIELDED;                                                                                           \
+        case __LINE__:;                                                                                                \
+    } while (0)
+
+/** Wait until cond is true. cond is checked again each time the task is
+ * woken, so something must wake the task when cond may have changed. */
+#define TASK_WAIT_UNTIL(task, cond)                                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (task)->Lc = __LINE__;                                                                                         \
+        case __LINE__:                                                                                                 \
+            if (!(cond))                                                                                               \
+            {                                                                                                          \
+                return TASK_WAITING;                                                                                   \
+            }                                                                                                          \
+    } while (0)
+
+/** Wait until cond is true, checking it on every run of the scheduler */
+#define TASK_POLL_UNTIL(task, cond)                                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (task)->Lc = __LINE__;                                                                                         \
+        case __LINE__:                                                                                                 \
+            if (!(cond))                                                                                               \
+            {                                                                                                          \
+                return TASK_YIELDED;                                                                                   \
+            }                                                                                                          \
+    } while (0)
+
+/** Wait for a signal of an event. An event has a single waiter: only one
+ * task may wait for a given event at a time. */
+#define TASK_AWAIT_EVENT(task, event) TASK_WAIT_UNTIL(task, TASK_EventTake((event), (task)))
+
+/** Wait for a number of timer wheel ticks */
+#define TASK_SLEEP(task, ticks)                                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        TMRWHEEL_Start(&(task)->Timer, (ticks), 0);                                                                    \
+        TASK_WAIT_UNTIL(task, !TMRWHEEL_IsActive(&(task)->Timer));                                                     \
+    } while (0)
+
+/** Wait until the timer wheel counter reaches deadline, for periodic work
+ * without drift: deadline += period; TASK_SLEEP_UNTIL(t, deadline); */
+#define TASK_SLEEP_UNTIL(task, deadline)                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        TMRWHEEL_Start(&(task)->Timer, TASK_TicksUntil(deadline), 0);                                                  \
+        TASK_WAIT_UNTIL(task, !TMRWHEEL_IsActive(&(task)->Timer));                                                     \
+    } while (0)
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup TASK_Public_Types TASK Public Types
+     * @{
+     */
+
+    /**
+     * @brief Result of a task run
+     */
+    typedef enum
+    {
+        TASK_WAITING = 0, /**< Blocked until woken */
+        TASK_YIELDED,     /**< Still ready, runs again after the others */
+        TASK_DONE         /**< Finished */
+    } TASK_RESULT_Type;
+
+    struct TASK_Task;
+
+    /** Task function */
+    typedef TASK_RESULT_Type (*TASK_Func)(struct TASK_Task* task);
+
+    /**
+     * @brief Task control block, owned by the caller
+     */
+    typedef struct TASK_Task
+    {
+        struct TASK_Task* Next;    /**< Ready queue link */
+        TASK_Func Func;            /**< Task function */
+        void* Arg;                 /**< Task argument */
+        TMRWHEEL_Timer_Type Timer; /**< Timer for TASK_SLEEP() */
+        uint16_t Lc;               /**< Resume point, source line of the last wait */
+        uint8_t Queued;            /**< In the ready queue */
+        uint8_t Done;              /**< Finished */
+    } TASK_Type;
+
+    /**
+     * @brief Event, counts signals until a task takes them. One task at a
+     * time may wait for it; several consumers need one event each.
+     */
+    typedef struct
+    {
+        volatile uint8_t Count;     /**< Signals not yet taken, saturates */
+        TASK_Type* volatile Waiter; /**< Task waiting for the event */
+    } TASK_Event_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup TASK_Public_Functions TASK Public Functions
+     * @{
+     */
+
+    void TASK_Start(TASK_Type* task, TASK_Func func, void* arg);
+    void TASK_Wake(TASK_Type* task);
+    void TASK_EventSignal(TASK_Event_Type* event);
+    Bool TASK_EventTake(TASK_Event_Type* event, TASK_Type* task);
+    uint32_t TASK_TicksUntil(uint32_t deadline);
+    uint32_t TASK_Run(void);
+    Bool TASK_IsReady(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_TASK_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
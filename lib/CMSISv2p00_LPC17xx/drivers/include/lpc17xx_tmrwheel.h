@@ -0,0 +1,156 @@
+/**********************************************************************
+ * $Id$		lpc17xx_tmrwheel.h				2026-10-18
+ *//**
+* @file		lpc17xx_tmrwheel.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the software timer wheel on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup TMRWHEEL TMRWHEEL (Software Timer Wheel)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ *
+ * Any number of one-shot and periodic software timers on a single hardware
+ * timer. The timer counter runs freely and one match register is programmed
+ * with the next deadline only (tickless), so timers expire on the exact
+ * timer tick they were set for, one PCLK period with a prescale of 1.
+ *
+ * Timers are kept in a hierarchical wheel of TMRWHEEL_LEVELS levels of 32
+ * slots, start and cancel are O(1). Expired timers are queued by
+ * TMRWHEEL_IRQHandler() and their callbacks run from TMRWHEEL_Dispatch(),
+ * called from the main loop, so callbacks may take their time.
+ *
+ * Usage:
+ *   void TIMER0_IRQHandler(void) { TMRWHEEL_IRQHandler(); }
+ *   ...
+ *   TMRWHEEL_Init(&cfg);
+ *   NVIC_EnableIRQ(TIMER0_IRQn);
+ *   TMRWHEEL_TimerInit(&dac_timer, dac_refresh, NULL);
+ *   TMRWHEEL_Start(&dac_timer, TMRWHEEL_UsToTicks(500000), TMRWHEEL_UsToTicks(500000));
+ *   while (1) { TMRWHEEL_Dispatch(); ... }
+ * @{
+ */
+
+#ifndef LPC17XX_TMRWHEEL_H_
+#define LPC17XX_TMRWHEEL_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup TMRWHEEL_Public_Macros TMRWHEEL Public Macros
+ * @{
+ */
+
+/** Longest delay or period in timer ticks, half the counter range */
+#define TMRWHEEL_MAX_TICKS ((uint32_t)0x7FFFFFFF)
+
+/**
+ * @}
+ */
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup TMRWHEEL_Private_Macros TMRWHEEL Private Macros
+ * @{
+ */
+
+/** Timer ticks per wheel slot at level 0, as a power of two */
+#define TMRWHEEL_GRAN_BITS (7)
+/** Slots per level, as a power of two */
+#define TMRWHEEL_SLOT_BITS (5)
+/** Slots per level */
+#define TMRWHEEL_SLOTS (1 << TMRWHEEL_SLOT_BITS)
+/** Levels, enough to cover the 32 bit counter */
+#define TMRWHEEL_LEVELS ((32 - TMRWHEEL_GRAN_BITS) / TMRWHEEL_SLOT_BITS)
+/** Mask of a wheel index, the counter value without the granularity bits */
+#define TMRWHEEL_INDEX_MASK (0xFFFFFFFFUL >> TMRWHEEL_GRAN_BITS)
+
+/* ---------------- CHECK PARAMETER DEFINITIONS ---------------------------- */
+/** Macro to check the match channel */
+#define PARAM_TMRWHEEL_MATCH_CHANNEL(n) ((n) <= 3)
+
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup TMRWHEEL_Public_Types TMRWHEEL Public Types
+     * @{
+     */
+
+    /** Timer callback, runs from TMRWHEEL_Dispatch() */
+    typedef void (*TMRWHEEL_Callback)(void* arg);
+
+    /**
+     * @brief Software timer, owned by the caller, must stay valid while started
+     */
+    typedef struct TMRWHEEL_Timer
+    {
+        struct TMRWHEEL_Timer* Next;      /**< Slot list link */
+        struct TMRWHEEL_Timer* Prev;      /**< Slot list link */
+        struct TMRWHEEL_Timer* ReadyNext; /**< Ready queue link */
+        uint32_t Expires;                 /**< Counter value of the next expiry */
+        uint32_t Period;                  /**< Period in ticks, 0 for a one-shot timer */
+        TMRWHEEL_Callback Callback;       /**< Callback function */
+        void* Arg;                        /**< Callback argument */
+        uint8_t Level;                    /**< Wheel level, 0xFF if not started */
+        uint8_t Slot;                     /**< Slot in the level */
+        uint8_t Queued;                   /**< In the ready queue */
+        uint8_t Pending;                  /**< Expiries not yet dispatched, saturates */
+    } TMRWHEEL_Timer_Type;
+
+    /**
+     * @brief Timer wheel configuration structure
+     */
+    typedef struct
+    {
+        LPC_TIM_TypeDef* TIMx;  /**< Hardware timer, LPC_TIM0..LPC_TIM3 */
+        uint8_t MatchChannel;   /**< Match register used for deadlines, 0..3 */
+        uint32_t PrescaleValue; /**< PCLK periods per tick, 1 for full resolution */
+    } TMRWHEEL_CFG_Type;
+
+    /**
+     * @}
+     */
+
+    /* Public Functions ----------------------------------------------------------- */
+    /** @defgroup TMRWHEEL_Public_Functions TMRWHEEL Public Functions
+     * @{
+     */
+
+    void TMRWHEEL_Init(const TMRWHEEL_CFG_Type* TMRWHEELConfigStruct);
+    uint32_t TMRWHEEL_Now(void);
+    uint32_t TMRWHEEL_UsToTicks(uint32_t usec);
+    void TMRWHEEL_TimerInit(TMRWHEEL_Timer_Type* timer, TMRWHEEL_Callback callback, void* arg);
+    Status TMRWHEEL_Start(TMRWHEEL_Timer_Type* timer, uint32_t delay, uint32_t period);
+    void TMRWHEEL_Cancel(TMRWHEEL_Timer_Type* timer);
+    Bool TMRWHEEL_IsActive(const TMRWHEEL_Timer_Type* timer);
+    Bool TMRWHEEL_GetNextDeadline(uint32_t* ticks);
+    Bool TMRWHEEL_WakeEarly(uint32_t ticks);
+    void TMRWHEEL_Adjust(uint32_t ticks);
+    void TMRWHEEL_IRQHandler(void);
+    uint32_t TMRWHEEL_Dispatch(void);
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_TMRWHEEL_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
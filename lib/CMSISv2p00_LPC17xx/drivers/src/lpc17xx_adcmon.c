@@ -0,0 +1,279 @@
+/**********************************************************************
+ * $Id$		lpc17xx_adcmon.c				2026-10-18
+ *//**
+* @file		lpc17xx_adcmon.c
+* @brief	Contains all functions support for the ADC window monitor
+* 			(analog watchdog with hysteresis) on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup ADCMON
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_adcmon.h"
+#include "lpc17xx_adc.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _ADCMON
+
+/* Private Types -------------------------------------------------------------- */
+/** @defgroup ADCMON_Private_Types ADCMON Private Types
+ * @{
+ */
+
+/**
+ * @brief Run-time state of one monitored channel
+ *
+ * StayLow/StayHigh hold the range of values that keeps the channel in its
+ * current zone, so the common case costs two compares per sample.
+ */
+typedef struct
+{
+    uint16_t StayLow;  /**< Lowest value that keeps the current zone */
+    uint16_t StayHigh; /**< Highest value that keeps the current zone */
+    uint16_t Low;      /**< Low threshold */
+    uint16_t High;     /**< High threshold */
+    uint16_t Hyst;     /**< Hysteresis */
+    uint8_t Zone;      /**< Current zone, ADCMON_ZONE_Type */
+    ADCMON_Callback_Type Callback;
+} ADCMON_Channel_Type;
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+static ADCMON_Channel_Type ADCMON_Channels[ADCMON_NUM_CHANNELS];
+/** Bit n set when channel n is evaluated */
+static uint8_t ADCMON_EnabledMask;
+
+/* Private Functions ---------------------------------------------------------- */
+/*******************************************************************************
+ * @brief		Reset a channel to the UNKNOWN zone so that the next sample
+ * 				is always classified and reported
+ * @param[in]	ch Pointer to channel state
+ * @return		None
+ *******************************************************************************/
+static void ADCMON_ResetZone(ADCMON_Channel_Type* ch)
+{
+    ch->Zone = ADCMON_ZONE_UNKNOWN;
+    /* Empty stay range: any value leaves the zone */
+    ch->StayLow = 1;
+    ch->StayHigh = 0;
+}
+
+/*******************************************************************************
+ * @brief		Classify a value that left the stay range of the current zone,
+ * 				update the stay range and report the transition
+ * @param[in]	channel ADC channel number
+ * @param[in]	ch Pointer to channel state
+ * @param[in]	value ADC result (counts)
+ * @return		None
+ *******************************************************************************/
+static void ADCMON_Transition(uint8_t channel, ADCMON_Channel_Type* ch, uint16_t value)
+{
+    uint8_t zone;
+
+    if (value >= ch->High)
+    {
+        zone = ADCMON_ZONE_HIGH;
+        ch->StayLow = ch->High - ch->Hyst;
+        ch->StayHigh = ADCMON_FULL_SCALE;
+    }
+    else if (value <= ch->Low)
+    {
+        zone = ADCMON_ZONE_LOW;
+        ch->StayLow = 0;
+        ch->StayHigh = ch->Low + ch->Hyst;
+    }
+    else
+    {
+        zone = ADCMON_ZONE_NORMAL;
+        ch->StayLow = ch->Low + 1;
+        ch->StayHigh = ch->High - 1;
+    }
+
+    if (zone != ch->Zone)
+    {
+        ch->Zone = zone;
+        if (ch->Callback != NULL)
+        {
+            ch->Callback(channel, (ADCMON_ZONE_Type)zone, value);
+        }
+    }
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup ADCMON_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the ADC window monitor, all channels disabled
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void ADCMON_Init(void)
+{
+    uint8_t i;
+
+    ADCMON_EnabledMask = 0;
+    for (i = 0; i < ADCMON_NUM_CHANNELS; i++)
+    {
+        ADCMON_Channels[i].Low = 0;
+        ADCMON_Channels[i].High = ADCMON_FULL_SCALE;
+        ADCMON_Channels[i].Hyst = 0;
+        ADCMON_Channels[i].Callback = NULL;
+        ADCMON_ResetZone(&ADCMON_Channels[i]);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Configure the window of one channel. The channel zone is
+ * 				reset to UNKNOWN, so the next sample is always reported.
+ * @param[in]	channel ADC channel number, should be 0..7
+ * @param[in]	ADCMONConfigStruct Pointer to a ADCMON_CFG_Type structure
+ * 				that contains thresholds, hysteresis and callback
+ * @return		None
+ *******************************************************************************/
+void ADCMON_ChannelConfig(uint8_t channel, const ADCMON_CFG_Type* ADCMONConfigStruct)
+{
+    ADCMON_Channel_Type* ch;
+    uint8_t enabled;
+
+    CHECK_PARAM(PARAM_ADCMON_CHANNEL(channel));
+    CHECK_PARAM(PARAM_ADCMON_WINDOW(ADCMONConfigStruct->LowThreshold, ADCMONConfigStruct->HighThreshold,
+                                    ADCMONConfigStruct->Hysteresis));
+
+    ch = &ADCMON_Channels[channel];
+
+    /* Keep the channel out of the sample path while it is rewritten */
+    enabled = ADCMON_EnabledMask & (1 << channel);
+    ADCMON_EnabledMask &= ~(1 << channel);
+
+    ch->Low = ADCMONConfigStruct->LowThreshold;
+    ch->High = ADCMONConfigStruct->HighThreshold;
+    ch->Hyst = ADCMONConfigStruct->Hysteresis;
+    ch->Callback = ADCMONConfigStruct->Callback;
+    ADCMON_ResetZone(ch);
+
+    ADCMON_EnabledMask |= enabled;
+}
+
+/*******************************************************************************
+ * @brief		Enable/Disable evaluation of a channel
+ * @param[in]	channel ADC channel number, should be 0..7
+ * @param[in]	NewState New state, should be:
+ * 					- ENABLE: samples of this channel are evaluated
+ * 					- DISABLE: samples of this channel are ignored
+ * @return		None
+ *******************************************************************************/
+void ADCMON_ChannelCmd(uint8_t channel, FunctionalState NewState)
+{
+    CHECK_PARAM(PARAM_ADCMON_CHANNEL(channel));
+    CHECK_PARAM(PARAM_FUNCTIONALSTATE(NewState));
+
+    if (NewState == ENABLE)
+    {
+        ADCMON_ResetZone(&ADCMON_Channels[channel]);
+        ADCMON_EnabledMask |= (1 << channel);
+    }
+    else
+    {
+        ADCMON_EnabledMask &= ~(1 << channel);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Get the current zone of a channel
+ * @param[in]	channel ADC channel number, should be 0..7
+ * @return		Current zone, ADCMON_ZONE_UNKNOWN until a sample is evaluated
+ *******************************************************************************/
+ADCMON_ZONE_Type ADCMON_GetZone(uint8_t channel)
+{
+    CHECK_PARAM(PARAM_ADCMON_CHANNEL(channel));
+
+    return (ADCMON_ZONE_Type)ADCMON_Channels[channel].Zone;
+}
+
+/*******************************************************************************
+ * @brief		Evaluate one sample of a channel. The callback is only called
+ * 				when the zone of the channel changes.
+ * @param[in]	channel ADC channel number, should be 0..7
+ * @param[in]	value ADC result in counts (0..4095)
+ * @return		None
+ *******************************************************************************/
+void ADCMON_Process(uint8_t channel, uint16_t value)
+{
+    ADCMON_Channel_Type* ch;
+
+    if (!(ADCMON_EnabledMask & (1 << channel)))
+    {
+        return;
+    }
+
+    ch = &ADCMON_Channels[channel];
+    if ((value < ch->StayLow) || (value > ch->StayHigh))
+    {
+        ADCMON_Transition(channel, ch, value);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Evaluate a buffer of raw ADC Global Data Register words, as
+ * 				written by GPDMA from ADGDR. Each word carries its own channel
+ * 				number, so buffers of interleaved (burst mode) channels are
+ * 				accepted. Words without the DONE flag are skipped.
+ * @param[in]	buffer Pointer to raw ADGDR words
+ * @param[in]	length Number of words in buffer
+ * @return		None
+ *******************************************************************************/
+void ADCMON_ProcessBuffer(const uint32_t* buffer, uint32_t length)
+{
+    ADCMON_Channel_Type* ch;
+    uint32_t word;
+    uint16_t value;
+    uint8_t channel;
+
+    while (length--)
+    {
+        word = *buffer++;
+        channel = ADC_GDR_CH(word);
+        if (!(word & ADC_GDR_DONE_FLAG) || !(ADCMON_EnabledMask & (1 << channel)))
+        {
+            continue;
+        }
+
+        value = ADC_GDR_RESULT(word);
+        ch = &ADCMON_Channels[channel];
+        if ((value < ch->StayLow) || (value > ch->StayHigh))
+        {
+            ADCMON_Transition(channel, ch, value);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* _ADCMON */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,139 @@
+/**********************************************************************
+ * $Id$		lpc17xx_bootprof.c				2026-10-18
+ *//**
+* @file		lpc17xx_bootprof.c
+* @brief	Contains all functions support for the boot time profiler
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup BOOTPROF
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_bootprof.h"
+#include "system_LPC17xx.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _BOOTPROF
+
+/* Private Variables ---------------------------------------------------------- */
+/** Marks live in .bss, so none can be taken before it is zero filled */
+static BOOTPROF_Mark_Type BOOTPROF_Marks[BOOTPROF_MAX_MARKS];
+static uint32_t BOOTPROF_Count;
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup BOOTPROF_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Record the end of a boot stage. The core clock is read back
+ * 				from the clock registers, since the PLL may have changed it.
+ * 				Marks beyond BOOTPROF_MAX_MARKS are dropped.
+ * @param[in]	name Stage name, must point to a constant string
+ * @return		None
+ *******************************************************************************/
+void BOOTPROF_Mark(const char* name)
+{
+    uint32_t cycles = BOOTPROF_DWT_CYCCNT;
+
+    if (BOOTPROF_Count >= BOOTPROF_MAX_MARKS)
+    {
+        return;
+    }
+
+    SystemCoreClockUpdate();
+    BOOTPROF_Marks[BOOTPROF_Count].Name = name;
+    BOOTPROF_Marks[BOOTPROF_Count].Cycles = cycles;
+    BOOTPROF_Marks[BOOTPROF_Count].ClockHz = SystemCoreClock;
+    BOOTPROF_Count++;
+}
+
+/*******************************************************************************
+ * @brief		Get the number of recorded marks
+ * @param[in]	None
+ * @return		Number of marks
+ *******************************************************************************/
+uint32_t BOOTPROF_GetCount(void)
+{
+    return BOOTPROF_Count;
+}
+
+/*******************************************************************************
+ * @brief		Get a recorded mark
+ * @param[in]	index Mark index, should be < BOOTPROF_GetCount()
+ * @return		Pointer to the mark, NULL if index is out of range
+ *******************************************************************************/
+const BOOTPROF_Mark_Type* BOOTPROF_GetMark(uint32_t index)
+{
+    return (index < BOOTPROF_Count) ? &BOOTPROF_Marks[index] : NULL;
+}
+
+/*******************************************************************************
+ * @brief		Get the duration of the stage ending at a mark. Stage 0 runs
+ * 				from reset on the 4 MHz internal RC oscillator; every later
+ * 				stage is converted with the clock of the previous mark.
+ * @param[in]	index Mark index, should be < BOOTPROF_GetCount()
+ * @return		Stage duration in microseconds, 0 if index is out of range
+ *******************************************************************************/
+uint32_t BOOTPROF_GetStageUs(uint32_t index)
+{
+    uint32_t cycles, clock;
+
+    if (index >= BOOTPROF_Count)
+    {
+        return 0;
+    }
+    if (index == 0)
+    {
+        cycles = BOOTPROF_Marks[0].Cycles;
+        clock = 4000000UL;
+    }
+    else
+    {
+        cycles = BOOTPROF_Marks[index].Cycles - BOOTPROF_Marks[index - 1].Cycles;
+        clock = BOOTPROF_Marks[index - 1].ClockHz;
+    }
+    return (uint32_t)(((uint64_t)cycles * 1000000UL) / clock);
+}
+
+/*******************************************************************************
+ * @brief		Get the time from reset to the last mark
+ * @param[in]	None
+ * @return		Total time in microseconds
+ *******************************************************************************/
+uint32_t BOOTPROF_GetTotalUs(void)
+{
+    uint32_t i, total = 0;
+
+    for (i = 0; i < BOOTPROF_Count; i++)
+    {
+        total += BOOTPROF_GetStageUs(i);
+    }
+    return total;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _BOOTPROF */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -275,6 +275,8 @@ void CLKPWR_ConfigPPWR(uint32_t PPType, FunctionalState NewState)
                                                                          **********************************************************************/
 void CLKPWR_Sleep(void)
 {
+    /* Clear SLEEPDEEP, it is left set by a previous Deep Sleep */
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
     LPC_SC->PCON = 0x00;
     /* Sleep Mode*/
     __WFI();
@@ -0,0 +1,281 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dds.c				2026-10-18
+ *//**
+* @file		lpc17xx_dds.c
+* @brief	Contains all functions support for direct digital synthesis
+* 			on the LPC17xx DAC
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup DDS
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_dds.h"
+#include "lpc17xx_dac.h"
+#include "lpc17xx_clkpwr.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _DDS
+
+/* Private Variables ---------------------------------------------------------- */
+static uint32_t* DDS_Buffer;
+static uint32_t DDS_Samples;
+static GPDMA_LLI_Type* DDS_Lli;
+static LPC_GPDMACH_TypeDef* DDS_Channel;
+static uint8_t DDS_ChannelNum;
+/** DAC timeout counter reload and its clock, in mHz, fixing the rate */
+static uint32_t DDS_Timeout;
+static uint64_t DDS_ClockMilliHz;
+/** Table and phase step, read once per block */
+static const uint16_t* volatile DDS_Table;
+static volatile uint8_t DDS_TableBits;
+static volatile uint8_t DDS_Interpolate;
+static volatile uint32_t DDS_Step;
+static uint32_t DDS_Phase;
+/** DACR bias bit, kept in every sample */
+static uint32_t DDS_Bias;
+
+/* Private Functions ---------------------------------------------------------- */
+/*******************************************************************************
+ * @brief		Generate one block of samples, continuing the phase
+ * @param[out]	out DACR words
+ * @param[in]	n Number of samples
+ * @return		None
+ *******************************************************************************/
+static void DDS_Fill(uint32_t* out, uint32_t n)
+{
+    const uint16_t* table = DDS_Table;
+    uint32_t bits = DDS_TableBits;
+    uint32_t shift = 32 - bits;
+    uint32_t mask = (1UL << bits) - 1;
+    uint32_t phase = DDS_Phase;
+    uint32_t step = DDS_Step;
+    uint32_t bias = DDS_Bias;
+    uint32_t i, frac;
+    int32_t a, b;
+
+    if (DDS_Interpolate)
+    {
+        while (n--)
+        {
+            i = phase >> shift;
+            frac = (phase << bits) >> 16;
+            a = table[i];
+            b = table[(i + 1) & mask];
+            *out++ = ((uint32_t)(a + (((b - a) * (int32_t)frac) >> 16)) << 6) | bias;
+            phase += step;
+        }
+    }
+    else
+    {
+        while (n--)
+        {
+            *out++ = ((uint32_t)table[phase >> shift] << 6) | bias;
+            phase += step;
+        }
+    }
+    DDS_Phase = phase;
+}
+
+/*******************************************************************************
+ * @brief		Terminal count callback, refills the half the DMA just left.
+ * 				The link of the item now loaded points back at that half, so
+ * 				terminal counts taken in one interrupt refill the right one.
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Not used
+ * @return		None
+ *******************************************************************************/
+static void DDS_Done(uint8_t channelNum, void* arg)
+{
+    uint32_t half = (DDS_Channel->DMACCLLI == (uint32_t)&DDS_Lli[1]) ? 1 : 0;
+
+    DDS_Fill(DDS_Buffer + half * DDS_Samples, DDS_Samples);
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup DDS_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the DDS: the DAC update rate, a GPDMA channel and
+ * 				the ping-pong linked list items. DAC_Init() and GPDMA_Init()
+ * 				must be called first, DMA_IRQHandler() must call
+ * 				GPDMA_IntHandler(). The frequency starts at 0.
+ * @param[in]	DDSConfigStruct Pointer to a DDS_CFG_Type structure
+ * @return		SUCCESS, or ERROR if the rate does not fit the DAC timeout
+ * 				counter or no channel is free
+ *******************************************************************************/
+Status DDS_Init(const DDS_CFG_Type* DDSConfigStruct)
+{
+    uint32_t pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC);
+    uint32_t timeout, i;
+    uint8_t ch;
+
+    CHECK_PARAM(PARAM_DDS_TABLE_BITS(DDSConfigStruct->TableBits));
+    CHECK_PARAM(PARAM_DDS_SAMPLES(DDSConfigStruct->Samples));
+    CHECK_PARAM(PARAM_GPDMA_PRIO(DDSConfigStruct->PrioClass));
+
+    if (DDSConfigStruct->RateHz == 0)
+    {
+        return ERROR;
+    }
+    timeout = (pclk + DDSConfigStruct->RateHz / 2) / DDSConfigStruct->RateHz;
+    if ((timeout == 0) || (timeout > 0xFFFF))
+    {
+        return ERROR;
+    }
+
+    ch = GPDMA_ChannelAlloc(DDSConfigStruct->PrioClass, FALSE);
+    if (ch == GPDMA_CHANNEL_NONE)
+    {
+        return ERROR;
+    }
+
+    DDS_Timeout = timeout;
+    DDS_ClockMilliHz = (uint64_t)pclk * 1000;
+    DDS_Buffer = DDSConfigStruct->Buffer;
+    DDS_Samples = DDSConfigStruct->Samples;
+    DDS_Lli = DDSConfigStruct->Lli;
+    DDS_ChannelNum = ch;
+    DDS_Channel = (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ch * 0x20);
+    DDS_Table = DDSConfigStruct->Table;
+    DDS_TableBits = DDSConfigStruct->TableBits;
+    DDS_Interpolate = DDSConfigStruct->Interpolate;
+    DDS_Step = 0;
+
+    for (i = 0; i < 2; i++)
+    {
+        DDS_Lli[i].SrcAddr = (uint32_t)(DDS_Buffer + i * DDS_Samples);
+        DDS_Lli[i].DstAddr = (uint32_t)&LPC_DAC->DACR;
+        DDS_Lli[i].NextLLI = (uint32_t)&DDS_Lli[i ^ 1];
+        DDS_Lli[i].Control = GPDMA_DMACCxControl_TransferSize(DDS_Samples) |
+                             GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_1) | GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_1) |
+                             GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |
+                             GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_SI |
+                             GPDMA_DMACCxControl_I;
+    }
+    GPDMA_SetCallback(ch, DDS_Done, NULL, NULL);
+
+    NVIC_EnableIRQ(DMA_IRQn);
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Start the output from phase 0, with both halves filled
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void DDS_Start(void)
+{
+    DAC_CONVERTER_CFG_Type dacCfg;
+
+    DDS_Bias = LPC_DAC->DACR & DAC_BIAS_EN;
+    DDS_Phase = 0;
+    DDS_Fill(DDS_Buffer, 2 * DDS_Samples);
+
+    LPC_GPDMA->DMACIntTCClear = GPDMA_DMACIntTCClear_Ch(DDS_ChannelNum);
+    LPC_GPDMA->DMACIntErrClr = GPDMA_DMACIntErrClr_Ch(DDS_ChannelNum);
+    DDS_Channel->DMACCSrcAddr = DDS_Lli[0].SrcAddr;
+    DDS_Channel->DMACCDestAddr = DDS_Lli[0].DstAddr;
+    DDS_Channel->DMACCLLI = DDS_Lli[0].NextLLI;
+    DDS_Channel->DMACCControl = DDS_Lli[0].Control;
+    DDS_Channel->DMACCConfig = GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_M2P) |
+                               GPDMA_DMACCxConfig_DestPeripheral(GPDMA_CONN_DAC) | GPDMA_DMACCxConfig_ITC |
+                               GPDMA_DMACCxConfig_E;
+
+    DAC_SetDMATimeOut(LPC_DAC, DDS_Timeout);
+    dacCfg.DBLBUF_ENA = 1;
+    dacCfg.CNT_ENA = 1;
+    dacCfg.DMA_ENA = 1;
+    DAC_ConfigDAConverterControl(LPC_DAC, &dacCfg);
+}
+
+/*******************************************************************************
+ * @brief		Stop the output, the DAC keeps the last sample
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void DDS_Stop(void)
+{
+    LPC_DAC->DACCTRL &= ~(DAC_DMA_ENA | DAC_CNT_ENA);
+    DDS_Channel->DMACCConfig &= ~GPDMA_DMACCxConfig_E;
+}
+
+/*******************************************************************************
+ * @brief		Set the output frequency, from the next block on
+ * @param[in]	milliHz Frequency in mHz, below half the update rate
+ * @return		None
+ *******************************************************************************/
+void DDS_SetFrequency(uint32_t milliHz)
+{
+    /* step = mHz * timeout * 2^32 / (pclk * 1000), by 16 bit long division
+     * so that no intermediate value overflows */
+    uint64_t num = (uint64_t)milliHz * DDS_Timeout;
+    uint64_t den = DDS_ClockMilliHz;
+    uint64_t rem = num % den;
+    uint32_t step = (uint32_t)(num / den) << 16;
+
+    rem <<= 16;
+    step = (step + (uint32_t)(rem / den)) << 16;
+    rem = (rem % den) << 16;
+    step += (uint32_t)(rem / den);
+
+    DDS_Step = step;
+}
+
+/*******************************************************************************
+ * @brief		Change the waveform, from the next block on
+ * @param[in]	table Waveform table, 2^tableBits DAC values
+ * @param[in]	tableBits log2 of the table size, 2..16
+ * @param[in]	interpolate TRUE for linear interpolation
+ * @return		None
+ *******************************************************************************/
+void DDS_SetTable(const uint16_t* table, uint8_t tableBits, Bool interpolate)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    CHECK_PARAM(PARAM_DDS_TABLE_BITS(tableBits));
+
+    __disable_irq();
+    DDS_Table = table;
+    DDS_TableBits = tableBits;
+    DDS_Interpolate = interpolate;
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Get the actual DAC update rate
+ * @param[in]	None
+ * @return		Samples per second, rounded
+ *******************************************************************************/
+uint32_t DDS_GetRate(void)
+{
+    return (uint32_t)((DDS_ClockMilliHz / 1000 + DDS_Timeout / 2) / DDS_Timeout);
+}
+
+/**
+ * @}
+ */
+
+#endif /* _DDS */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
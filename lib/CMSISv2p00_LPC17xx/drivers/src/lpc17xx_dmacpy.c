@@ -0,0 +1,510 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dmacpy.c				2026-10-18
+ *//**
+* @file		lpc17xx_dmacpy.c
+* @brief	Contains all functions support for DMA memory copy and fill
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup DMACPY
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_dmacpy.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_bootprof.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _DMACPY
+
+/* Private Macros ------------------------------------------------------------- */
+/** TRUE if [addr, addr + len) is in AHB SRAM */
+#define DMACPY_IN_AHB(addr, len) \
+    (((addr) >= DMACPY_AHB_START) && ((addr) <= DMACPY_AHB_END) && ((len) <= DMACPY_AHB_END - (addr)))
+
+/* Private Variables ---------------------------------------------------------- */
+static uint32_t DMACPY_Threshold = DMACPY_DEFAULT_THRESHOLD;
+
+/* Private Functions ---------------------------------------------------------- */
+/*******************************************************************************
+ * @brief		Start the next chunk of an operation on its channel
+ * @param[in]	op Pointer to the operation
+ * @return		None
+ *******************************************************************************/
+static void DMACPY_Start(DMACPY_Op_Type* op)
+{
+    GPDMA_PROGRAM_Type program;
+    uint32_t n = (op->Words > DMACPY_MAX_CHUNK) ? DMACPY_MAX_CHUNK : op->Words;
+
+    program.SrcAddr = op->IsFill ? (uint32_t)&op->Fill : op->Src;
+    program.DstAddr = op->Dst;
+    program.LLI = 0;
+    program.Control = GPDMA_DMACCxControl_TransferSize(n) | GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_32) |
+                      GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_32) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |
+                      GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | (op->IsFill ? 0 : GPDMA_DMACCxControl_SI) |
+                      GPDMA_DMACCxControl_DI | GPDMA_DMACCxControl_I;
+    program.Config = GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_M2M) | GPDMA_DMACCxConfig_IE |
+                     GPDMA_DMACCxConfig_ITC;
+
+    op->Words -= n;
+    op->Dst += n << 2;
+    op->Src += n << 2;
+    GPDMA_Arm(op->ChannelNum, &program);
+}
+
+/*******************************************************************************
+ * @brief		Free the channel of an operation and complete it
+ * @param[in]	op Pointer to the operation
+ * @param[in]	state DMACPY_DONE or DMACPY_FAILED
+ * @return		None
+ *******************************************************************************/
+static void DMACPY_End(DMACPY_Op_Type* op, uint8_t state)
+{
+    GPDMA_ChannelFree(op->ChannelNum);
+    op->State = state;
+    if (op->Callback)
+    {
+        op->Callback(op->Arg);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Terminal count callback, starts the next chunk or completes
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Pointer to the operation
+ * @return		None
+ *******************************************************************************/
+static void DMACPY_Done(uint8_t channelNum, void* arg)
+{
+    DMACPY_Op_Type* op = (DMACPY_Op_Type*)arg;
+
+    if (op->Words)
+    {
+        DMACPY_Start(op);
+    }
+    else
+    {
+        DMACPY_End(op, DMACPY_DONE);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Error callback
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Pointer to the operation
+ * @return		None
+ *******************************************************************************/
+static void DMACPY_Error(uint8_t channelNum, void* arg)
+{
+    DMACPY_End((DMACPY_Op_Type*)arg, DMACPY_FAILED);
+}
+
+/*******************************************************************************
+ * @brief		Try to run an operation on a DMA channel
+ * @param[in]	op Pointer to the operation, Dst, Src, Words and IsFill set
+ * @return		SUCCESS if started, ERROR if no channel is free
+ *******************************************************************************/
+static Status DMACPY_StartDma(DMACPY_Op_Type* op)
+{
+    uint8_t ch = GPDMA_ChannelAlloc(GPDMA_PRIO_LOW, FALSE);
+
+    if (ch == GPDMA_CHANNEL_NONE)
+    {
+        return ERROR;
+    }
+    op->ChannelNum = ch;
+    op->State = DMACPY_PENDING;
+    GPDMA_SetCallback(ch, DMACPY_Done, DMACPY_Error, op);
+    DMACPY_Start(op);
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Time a load/store loop over some data
+ * @param[in]	data Data, read and written once per word
+ * @param[in]	words Number of words
+ * @return		Cycles taken
+ *******************************************************************************/
+static uint32_t DMACPY_Kernel(volatile uint32_t* data, uint32_t words)
+{
+    uint32_t t0 = BOOTPROF_DWT_CYCCNT;
+    uint32_t i;
+
+    for (i = 0; i < words; i++)
+    {
+        data[i] += i;
+    }
+    return BOOTPROF_DWT_CYCCNT - t0;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup DMACPY_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize: enable the GPDMA interrupt. GPDMA_Init() enables
+ * 				the controller and must be called first.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void DMACPY_Init(void)
+{
+    NVIC_EnableIRQ(DMA_IRQn);
+}
+
+/*******************************************************************************
+ * @brief		Set the size from which operations use DMA
+ * @param[in]	bytes Threshold in bytes
+ * @return		None
+ *******************************************************************************/
+void DMACPY_SetThreshold(uint32_t bytes)
+{
+    DMACPY_Threshold = bytes;
+}
+
+/*******************************************************************************
+ * @brief		Get the size from which operations use DMA
+ * @param[in]	None
+ * @return		Threshold in bytes
+ *******************************************************************************/
+uint32_t DMACPY_GetThreshold(void)
+{
+    return DMACPY_Threshold;
+}
+
+/*******************************************************************************
+ * @brief		Copy memory, on a DMA channel or on the CPU. The regions must
+ * 				not overlap.
+ * @param[out]	op Pointer to the operation, not pending
+ * @param[in]	dst Destination
+ * @param[in]	src Source
+ * @param[in]	len Number of bytes
+ * @param[in]	callback Called when done, or NULL
+ * @param[in]	arg Passed to the callback
+ * @return		None
+ *******************************************************************************/
+void DMACPY_Copy(DMACPY_Op_Type* op,
+                 void* dst,
+                 const void* src,
+                 uint32_t len,
+                 DMACPY_Callback callback,
+                 void* arg)
+{
+    uint32_t d = (uint32_t)dst;
+    uint32_t s = (uint32_t)src;
+    uint32_t tail = len & 3;
+
+    op->Callback = callback;
+    op->Arg = arg;
+
+    if ((len >= DMACPY_Threshold) && (len >= 4) && (((d | s) & 3) == 0) && DMACPY_IN_AHB(d, len) &&
+        DMACPY_IN_AHB(s, len))
+    {
+        /* The bytes past the last word go first, on the CPU */
+        DMACPY_CpuCopy((uint8_t*)dst + len - tail, (const uint8_t*)src + len - tail, tail);
+        op->Dst = d;
+        op->Src = s;
+        op->Words = len >> 2;
+        op->IsFill = FALSE;
+        if (DMACPY_StartDma(op) == SUCCESS)
+        {
+            return;
+        }
+    }
+
+    DMACPY_CpuCopy(dst, src, len);
+    op->State = DMACPY_DONE;
+    if (callback)
+    {
+        callback(arg);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Fill memory, on a DMA channel or on the CPU. Uses DMA only if
+ * 				the operation is in AHB SRAM.
+ * @param[out]	op Pointer to the operation, not pending
+ * @param[in]	dst Destination
+ * @param[in]	value Fill byte
+ * @param[in]	len Number of bytes
+ * @param[in]	callback Called when done, or NULL
+ * @param[in]	arg Passed to the callback
+ * @return		None
+ *******************************************************************************/
+void DMACPY_Set(DMACPY_Op_Type* op, void* dst, uint8_t value, uint32_t len, DMACPY_Callback callback, void* arg)
+{
+    uint32_t d = (uint32_t)dst;
+    uint32_t tail = len & 3;
+
+    op->Callback = callback;
+    op->Arg = arg;
+    op->Fill = value * 0x01010101UL;
+
+    if ((len >= DMACPY_Threshold) && (len >= 4) && ((d & 3) == 0) && DMACPY_IN_AHB(d, len) &&
+        DMACPY_IN_AHB((uint32_t)&op->Fill, 4))
+    {
+        DMACPY_CpuSet((uint8_t*)dst + len - tail, value, tail);
+        op->Dst = d;
+        op->Src = 0;
+        op->Words = len >> 2;
+        op->IsFill = TRUE;
+        if (DMACPY_StartDma(op) == SUCCESS)
+        {
+            return;
+        }
+    }
+
+    DMACPY_CpuSet(dst, value, len);
+    op->State = DMACPY_DONE;
+    if (callback)
+    {
+        callback(arg);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Check whether an operation has finished
+ * @param[in]	op Pointer to the operation
+ * @return		TRUE unless it is running on a DMA channel
+ *******************************************************************************/
+Bool DMACPY_IsDone(const DMACPY_Op_Type* op)
+{
+    return (op->State == DMACPY_PENDING) ? FALSE : TRUE;
+}
+
+/*******************************************************************************
+ * @brief		Wait for an operation to finish, needs the DMA interrupt
+ * @param[in]	op Pointer to the operation
+ * @return		DMACPY_DONE, or DMACPY_FAILED on a DMA error
+ *******************************************************************************/
+uint8_t DMACPY_Wait(const DMACPY_Op_Type* op)
+{
+    while (op->State == DMACPY_PENDING)
+        ;
+    return op->State;
+}
+
+/*******************************************************************************
+ * @brief		Copy memory on the CPU. Word aligned regions are copied four
+ * 				words per iteration, which compiles to LDM/STM.
+ * @param[in]	dst Destination
+ * @param[in]	src Source
+ * @param[in]	len Number of bytes
+ * @return		None
+ *******************************************************************************/
+void DMACPY_CpuCopy(void* dst, const void* src, uint32_t len)
+{
+    uint32_t* dw = (uint32_t*)dst;
+    const uint32_t* sw = (const uint32_t*)src;
+    uint8_t* db;
+    const uint8_t* sb;
+
+    if ((((uint32_t)dst | (uint32_t)src) & 3) == 0)
+    {
+        for (; len >= 16; len -= 16)
+        {
+            uint32_t w0 = sw[0], w1 = sw[1], w2 = sw[2], w3 = sw[3];
+
+            dw[0] = w0;
+            dw[1] = w1;
+            dw[2] = w2;
+            dw[3] = w3;
+            dw += 4;
+            sw += 4;
+        }
+        for (; len >= 4; len -= 4)
+        {
+            *dw++ = *sw++;
+        }
+    }
+
+    db = (uint8_t*)dw;
+    sb = (const uint8_t*)sw;
+    while (len--)
+    {
+        *db++ = *sb++;
+    }
+}
+
+/*******************************************************************************
+ * @brief		Fill memory on the CPU, four words per iteration when aligned
+ * @param[in]	dst Destination
+ * @param[in]	value Fill byte
+ * @param[in]	len Number of bytes
+ * @return		None
+ *******************************************************************************/
+void DMACPY_CpuSet(void* dst, uint8_t value, uint32_t len)
+{
+    uint8_t* db = (uint8_t*)dst;
+    uint32_t* dw;
+    uint32_t w = value * 0x01010101UL;
+
+    while (((uint32_t)db & 3) && len)
+    {
+        *db++ = value;
+        len--;
+    }
+
+    dw = (uint32_t*)db;
+    for (; len >= 16; len -= 16)
+    {
+        dw[0] = w;
+        dw[1] = w;
+        dw[2] = w;
+        dw[3] = w;
+        dw += 4;
+    }
+    for (; len >= 4; len -= 4)
+    {
+        *dw++ = w;
+    }
+
+    db = (uint8_t*)dw;
+    while (len--)
+    {
+        *db++ = value;
+    }
+}
+
+/*******************************************************************************
+ * @brief		Measure the CPU/DMA crossover and set the threshold to it:
+ * 				copies of 16 bytes and up, doubling, are timed from the call
+ * 				to completion with the DWT cycle counter on both paths. The
+ * 				DMA interrupt must be enabled and dispatched, and a DMA
+ * 				channel free.
+ * @param[in]	scratch Word aligned buffer in AHB SRAM
+ * @param[in]	size Size of scratch in bytes, copies go up to half of it
+ * @return		The new threshold, the smallest size where DMA completes no
+ * 				later than the CPU, or size if DMA never does; 0 if a copy
+ * 				could not run on a DMA channel, the threshold is unchanged
+ *******************************************************************************/
+uint32_t DMACPY_Calibrate(void* scratch, uint32_t size)
+{
+    DMACPY_Op_Type op;
+    uint8_t* dst = (uint8_t*)scratch;
+    uint8_t* src = dst + size / 2;
+    uint32_t saved = DMACPY_Threshold;
+    uint32_t len, t0, cpu, dma, primask;
+    Bool onDma;
+
+    CoreDebug->DEMCR |= BOOTPROF_DEMCR_TRCENA;
+    BOOTPROF_DWT_CTRL |= BOOTPROF_DWT_CTRL_CYCCNTENA;
+
+    for (len = 16; len <= size / 2; len <<= 1)
+    {
+        t0 = BOOTPROF_DWT_CYCCNT;
+        DMACPY_CpuCopy(dst, src, len);
+        cpu = BOOTPROF_DWT_CYCCNT - t0;
+
+        /* The completion interrupt waits for the state check: a copy done
+         * on return fell back to the CPU */
+        DMACPY_Threshold = 0;
+        primask = __get_PRIMASK();
+        t0 = BOOTPROF_DWT_CYCCNT;
+        __disable_irq();
+        DMACPY_Copy(&op, dst, src, len, NULL, NULL);
+        onDma = (op.State == DMACPY_PENDING) ? TRUE : FALSE;
+        __set_PRIMASK(primask);
+        DMACPY_Wait(&op);
+        dma = BOOTPROF_DWT_CYCCNT - t0;
+
+        if (!onDma)
+        {
+            DMACPY_Threshold = saved;
+            return 0;
+        }
+        if (dma <= cpu)
+        {
+            DMACPY_Threshold = len;
+            return len;
+        }
+    }
+
+    DMACPY_Threshold = size;
+    return size;
+}
+
+/*******************************************************************************
+ * @brief		Measure the CPU stall caused by a DMA stream: a load/store
+ * 				loop over data is timed with the DWT cycle counter, idle and
+ * 				while a DMA copy runs from the upper to the lower half of
+ * 				scratch, with interrupts masked. Needs a free DMA channel.
+ * @param[in]	scratch Word aligned buffer in AHB SRAM, the DMA traffic
+ * @param[in]	size Size of scratch in bytes, the copy moves half of it, up
+ * 				to DMACPY_MAX_CHUNK words
+ * @param[in]	data Word aligned data of the CPU loop, anywhere in SRAM
+ * @param[in]	words Number of words of data
+ * @return		Cycles the loop lost to the DMA stream,
+ * 				DMACPY_STALL_UNCOVERED if the copy ended before the loop, or
+ * 				DMACPY_STALL_NO_CHANNEL if it could not run on a DMA channel
+ *******************************************************************************/
+uint32_t DMACPY_MeasureStall(void* scratch, uint32_t size, volatile uint32_t* data, uint32_t words)
+{
+    DMACPY_Op_Type op;
+    uint32_t saved = DMACPY_Threshold;
+    uint32_t len = size / 2;
+    uint32_t primask, idle, busy;
+    Bool covered;
+
+    if (len > DMACPY_MAX_CHUNK * 4)
+    {
+        len = DMACPY_MAX_CHUNK * 4;
+    }
+
+    CoreDebug->DEMCR |= BOOTPROF_DEMCR_TRCENA;
+    BOOTPROF_DWT_CTRL |= BOOTPROF_DWT_CTRL_CYCCNTENA;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Once to warm the flash accelerator up */
+    DMACPY_Kernel(data, words);
+    idle = DMACPY_Kernel(data, words);
+
+    DMACPY_Threshold = 0;
+    DMACPY_Copy(&op, scratch, (uint8_t*)scratch + size / 2, len, NULL, NULL);
+    DMACPY_Threshold = saved;
+    if (op.State != DMACPY_PENDING)
+    {
+        /* Done on the CPU, with interrupts masked a DMA copy is pending */
+        __set_PRIMASK(primask);
+        return DMACPY_STALL_NO_CHANNEL;
+    }
+    busy = DMACPY_Kernel(data, words);
+    covered = (LPC_GPDMA->DMACEnbldChns & (1 << op.ChannelNum)) ? TRUE : FALSE;
+
+    __set_PRIMASK(primask);
+    DMACPY_Wait(&op);
+
+    if (!covered)
+    {
+        return DMACPY_STALL_UNCOVERED;
+    }
+    return (busy > idle) ? busy - idle : 0;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _DMACPY */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
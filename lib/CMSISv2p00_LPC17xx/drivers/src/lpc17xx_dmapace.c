@@ -0,0 +1,376 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dmapace.c				2026-10-18
+ *//**
+* @file		lpc17xx_dmapace.c
+* @brief	Contains all functions support for timer-paced DMA copies on
+* 			LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup DMAPACE
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_dmapace.h"
+#include "lpc17xx_timer.h"
+#include "lpc17xx_clkpwr.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _DMAPACE
+
+/* Private Functions ---------------------------------------------------------- */
+/*******************************************************************************
+ * @brief		End a copy: stop the timer and run the callback
+ * @param[in]	pace Pointer to the copier
+ * @param[in]	failed TRUE on a DMA error
+ * @return		None
+ *******************************************************************************/
+static void DMAPACE_End(DMAPACE_Type* pace, uint8_t failed)
+{
+    pace->TIMx->TCR = 0;
+    pace->Failed = failed;
+    pace->Busy = FALSE;
+    if (pace->Callback)
+    {
+        pace->Callback(pace->Arg);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Terminal count callback, from the last linked list item
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Pointer to the copier
+ * @return		None
+ *******************************************************************************/
+static void DMAPACE_Done(uint8_t channelNum, void* arg)
+{
+    DMAPACE_End((DMAPACE_Type*)arg, FALSE);
+}
+
+/*******************************************************************************
+ * @brief		Error callback
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Pointer to the copier
+ * @return		None
+ *******************************************************************************/
+static void DMAPACE_Error(uint8_t channelNum, void* arg)
+{
+    DMAPACE_End((DMAPACE_Type*)arg, TRUE);
+}
+
+/*******************************************************************************
+ * @brief		Split a block in chunks, one per linked list item, and start
+ * 				the channel on the first one
+ * @param[in]	pace Pointer to the copier
+ * @param[in]	dst Destination address
+ * @param[in]	src Source address
+ * @param[in]	count Number of items
+ * @param[in]	lli Linked list items, or NULL for a single chunk copied once
+ * @param[in]	numLLI Number of items in lli
+ * @param[in]	loop TRUE to link the last chunk back to the first one
+ * @return		SUCCESS, or ERROR if count is 0 or there are too few linked
+ * 				list items
+ *******************************************************************************/
+static Status DMAPACE_Start(DMAPACE_Type* pace,
+                            uint32_t dst,
+                            uint32_t src,
+                            uint32_t count,
+                            GPDMA_LLI_Type* lli,
+                            uint32_t numLLI,
+                            Bool loop)
+{
+    LPC_GPDMACH_TypeDef* ch = pace->Channel;
+    GPDMA_LLI_Type single;
+    uint32_t chunks = DMAPACE_LLI_COUNT(count);
+    uint32_t srcStep = ((pace->Control & GPDMA_DMACCxControl_SI) ? DMAPACE_MAX_CHUNK : 0) << pace->Width;
+    uint32_t dstStep = ((pace->Control & GPDMA_DMACCxControl_DI) ? DMAPACE_MAX_CHUNK : 0) << pace->Width;
+    uint32_t i, n;
+
+    if (count == 0)
+    {
+        return ERROR;
+    }
+    if (lli == NULL)
+    {
+        /* The channel registers hold a single chunk, and are not reloaded */
+        if ((chunks > 1) || loop)
+        {
+            return ERROR;
+        }
+        lli = &single;
+    }
+    else if (numLLI < chunks)
+    {
+        return ERROR;
+    }
+
+    /* Every chunk but the last is DMAPACE_MAX_CHUNK items long, so the
+     * address steps are fixed; only the last one of a single copy
+     * interrupts */
+    for (i = 0; i < chunks; i++)
+    {
+        n = (count > DMAPACE_MAX_CHUNK) ? DMAPACE_MAX_CHUNK : count;
+        count -= n;
+        lli[i].SrcAddr = src + i * srcStep;
+        lli[i].DstAddr = dst + i * dstStep;
+        lli[i].Control = pace->Control | GPDMA_DMACCxControl_TransferSize(n) |
+                         ((count || loop) ? 0 : GPDMA_DMACCxControl_I);
+        if (count)
+        {
+            lli[i].NextLLI = (uint32_t)&lli[i + 1];
+        }
+        else
+        {
+            lli[i].NextLLI = loop ? (uint32_t)&lli[0] : 0;
+        }
+    }
+
+    pace->Failed = FALSE;
+    pace->Busy = TRUE;
+
+    /* Hold the timer in reset and drop a request left from an old match */
+    pace->TIMx->TCR = TIM_RESET;
+    pace->TIMx->IR = TIM_IR_CLR(pace->MatchChannel);
+
+    LPC_GPDMA->DMACIntTCClear = GPDMA_DMACIntTCClear_Ch(pace->ChannelNum);
+    LPC_GPDMA->DMACIntErrClr = GPDMA_DMACIntErrClr_Ch(pace->ChannelNum);
+    ch->DMACCSrcAddr = lli[0].SrcAddr;
+    ch->DMACCDestAddr = lli[0].DstAddr;
+    ch->DMACCLLI = lli[0].NextLLI;
+    ch->DMACCControl = lli[0].Control;
+    ch->DMACCConfig = pace->Config | GPDMA_DMACCxConfig_E;
+
+    pace->TIMx->TCR = TIM_ENABLE;
+    return SUCCESS;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup DMAPACE_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize a paced copier: allocate a channel, claim the match
+ * 				request line and set up the pacing timer (from CCLK, reset on
+ * 				match). GPDMA_Init() must be called first.
+ * @param[in]	pace Pointer to the copier
+ * @param[in]	DMAPACEConfigStruct Pointer to a DMAPACE_CFG_Type structure
+ * @return		SUCCESS, or ERROR if RateHz is 0 or above the timer clock, no
+ * 				channel is free or the request line is claimed by a UART
+ * 				channel
+ *******************************************************************************/
+Status DMAPACE_Init(DMAPACE_Type* pace, const DMAPACE_CFG_Type* DMAPACEConfigStruct)
+{
+    TIM_TIMERCFG_Type timerCfg;
+    LPC_TIM_TypeDef* TIMx = DMAPACEConfigStruct->TIMx;
+    uint32_t match = DMAPACEConfigStruct->MatchChannel;
+    uint32_t pclksel, timerNum, period;
+    uint8_t ch;
+
+    CHECK_PARAM(PARAM_TIMx(TIMx));
+    CHECK_PARAM(PARAM_DMAPACE_MATCH_CHANNEL(match));
+    CHECK_PARAM(PARAM_DMAPACE_WIDTH(DMAPACEConfigStruct->Width));
+    CHECK_PARAM(PARAM_GPDMA_PRIO(DMAPACEConfigStruct->PrioClass));
+
+    if (TIMx == LPC_TIM0)
+    {
+        timerNum = 0;
+        pclksel = CLKPWR_PCLKSEL_TIMER0;
+    }
+    else if (TIMx == LPC_TIM1)
+    {
+        timerNum = 1;
+        pclksel = CLKPWR_PCLKSEL_TIMER1;
+    }
+    else if (TIMx == LPC_TIM2)
+    {
+        timerNum = 2;
+        pclksel = CLKPWR_PCLKSEL_TIMER2;
+    }
+    else
+    {
+        timerNum = 3;
+        pclksel = CLKPWR_PCLKSEL_TIMER3;
+    }
+
+    if (DMAPACEConfigStruct->RateHz == 0)
+    {
+        return ERROR;
+    }
+
+    timerCfg.PrescaleOption = TIM_PRESCALE_TICKVAL;
+    timerCfg.PrescaleValue = 1;
+    TIM_Init(TIMx, TIM_TIMER_MODE, &timerCfg);
+    CLKPWR_SetPCLKDiv(pclksel, CLKPWR_PCLKSEL_CCLK_DIV_1);
+
+    period = (CLKPWR_GetPCLK(pclksel) + DMAPACEConfigStruct->RateHz / 2) / DMAPACEConfigStruct->RateHz;
+    if (period == 0)
+    {
+        return ERROR;
+    }
+
+    ch = GPDMA_ChannelAlloc(DMAPACEConfigStruct->PrioClass, FALSE);
+    if (ch == GPDMA_CHANNEL_NONE)
+    {
+        return ERROR;
+    }
+    /* MATn.m replaces the UART request 8 + 2n + m */
+    if (GPDMA_ReqSelClaim(ch, GPDMA_CONN_MAT0_0 + timerNum * 2 + match) == ERROR)
+    {
+        GPDMA_ChannelFree(ch);
+        return ERROR;
+    }
+
+    /* Match resets the counter, no interrupt, no stop */
+    TIMx->TCR = 0;
+    (&TIMx->MR0)[match] = period - 1;
+    TIMx->MCR = (TIMx->MCR & ~(TIM_INT_ON_MATCH(match) | TIM_STOP_ON_MATCH(match))) | TIM_RESET_ON_MATCH(match);
+
+    pace->Channel = (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ch * 0x20);
+    pace->ChannelNum = ch;
+    pace->TIMx = TIMx;
+    pace->MatchChannel = (uint8_t)match;
+    pace->Width = DMAPACEConfigStruct->Width;
+    pace->Busy = FALSE;
+    pace->Failed = FALSE;
+    pace->Control = GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_1) | GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_1) |
+                    GPDMA_DMACCxControl_SWidth((uint32_t)pace->Width) |
+                    GPDMA_DMACCxControl_DWidth((uint32_t)pace->Width) |
+                    (DMAPACEConfigStruct->SrcInc ? GPDMA_DMACCxControl_SI : 0) |
+                    (DMAPACEConfigStruct->DstInc ? GPDMA_DMACCxControl_DI : 0);
+    pace->Config = GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_M2P) |
+                   GPDMA_DMACCxConfig_DestPeripheral((8 + timerNum * 2 + match)) | GPDMA_DMACCxConfig_IE |
+                   GPDMA_DMACCxConfig_ITC;
+    GPDMA_SetCallback(ch, DMAPACE_Done, DMAPACE_Error, pace);
+    NVIC_EnableIRQ(DMA_IRQn);
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Stop a copier and free its channel and request line
+ * @param[in]	pace Pointer to the copier
+ * @return		None
+ *******************************************************************************/
+void DMAPACE_DeInit(DMAPACE_Type* pace)
+{
+    DMAPACE_Abort(pace);
+    GPDMA_ChannelFree(pace->ChannelNum);
+}
+
+/*******************************************************************************
+ * @brief		Start a copy, one item per timer match. The linked list items
+ * 				are built here and must stay untouched until the end.
+ * @param[in]	pace Pointer to the copier
+ * @param[in]	dst Destination, in AHB SRAM or a peripheral
+ * @param[in]	src Source, in AHB SRAM, flash or a peripheral
+ * @param[in]	count Number of items
+ * @param[in]	lli Linked list items in AHB SRAM, or NULL if count is at
+ * 				most DMAPACE_MAX_CHUNK
+ * @param[in]	numLLI Number of items in lli, at least DMAPACE_LLI_COUNT(count)
+ * @param[in]	callback Called from the DMA interrupt at the end, or NULL
+ * @param[in]	arg Passed to the callback
+ * @return		SUCCESS, or ERROR if the copier is busy, count is 0 or there
+ * 				are too few linked list items
+ *******************************************************************************/
+Status DMAPACE_Copy(DMAPACE_Type* pace,
+                    void* dst,
+                    const void* src,
+                    uint32_t count,
+                    GPDMA_LLI_Type* lli,
+                    uint32_t numLLI,
+                    DMAPACE_Callback callback,
+                    void* arg)
+{
+    if (pace->Busy)
+    {
+        return ERROR;
+    }
+    pace->Callback = callback;
+    pace->Arg = arg;
+    return DMAPACE_Start(pace, (uint32_t)dst, (uint32_t)src, count, lli, numLLI, FALSE);
+}
+
+/*******************************************************************************
+ * @brief		Start copying a block over and over, one item per timer match,
+ * 				until DMAPACE_Abort(). No callback runs. The linked list items
+ * 				are built here and must stay untouched until the abort.
+ * @param[in]	pace Pointer to the copier
+ * @param[in]	dst Destination, in AHB SRAM or a peripheral
+ * @param[in]	src Source, in AHB SRAM, flash or a peripheral
+ * @param[in]	count Number of items
+ * @param[in]	lli Linked list items, in AHB SRAM
+ * @param[in]	numLLI Number of items in lli, at least DMAPACE_LLI_COUNT(count)
+ * @return		SUCCESS, or ERROR if the copier is busy, count is 0 or there
+ * 				are too few linked list items
+ *******************************************************************************/
+Status DMAPACE_Loop(DMAPACE_Type* pace,
+                    void* dst,
+                    const void* src,
+                    uint32_t count,
+                    GPDMA_LLI_Type* lli,
+                    uint32_t numLLI)
+{
+    if (pace->Busy)
+    {
+        return ERROR;
+    }
+    pace->Callback = NULL;
+    pace->Arg = NULL;
+    return DMAPACE_Start(pace, (uint32_t)dst, (uint32_t)src, count, lli, numLLI, TRUE);
+}
+
+/*******************************************************************************
+ * @brief		Abort a copy, without running the callback. The items already
+ * 				read by the channel are written out first.
+ * @param[in]	pace Pointer to the copier
+ * @return		None
+ *******************************************************************************/
+void DMAPACE_Abort(DMAPACE_Type* pace)
+{
+    LPC_GPDMACH_TypeDef* ch = pace->Channel;
+
+    /* Halt, and let the timer requests drain the channel FIFO */
+    ch->DMACCConfig |= GPDMA_DMACCxConfig_H;
+    while (ch->DMACCConfig & GPDMA_DMACCxConfig_A)
+        ;
+    ch->DMACCConfig &= ~(GPDMA_DMACCxConfig_E | GPDMA_DMACCxConfig_H);
+    pace->TIMx->TCR = 0;
+    LPC_GPDMA->DMACIntTCClear = GPDMA_DMACIntTCClear_Ch(pace->ChannelNum);
+    pace->Busy = FALSE;
+}
+
+/*******************************************************************************
+ * @brief		Check whether a copy is running
+ * @param[in]	pace Pointer to the copier
+ * @return		TRUE until the callback of the copy has run, or until
+ * 				DMAPACE_Abort() for a loop
+ *******************************************************************************/
+Bool DMAPACE_IsBusy(const DMAPACE_Type* pace)
+{
+    return pace->Busy ? TRUE : FALSE;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _DMAPACE */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,137 @@
+/**********************************************************************
+ * $Id$		lpc17xx_dmapat.c				2026-10-18
+ *//**
+* @file		lpc17xx_dmapat.c
+* @brief	Contains all functions support for DMA-driven GPIO pattern
+* 			output on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup DMAPAT
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_dmapat.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _DMAPAT
+
+/* Private Macros ------------------------------------------------------------- */
+/** Offset of FIOPIN in a GPIO port, FIOSET and FIOCLR follow it */
+#define DMAPAT_FIOPIN_OFFSET (0x14)
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup DMAPAT_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize a pattern player: a paced copier (DMAPACE) with an
+ * 				incremented source and the GPIO register as fixed destination.
+ * 				GPDMA_Init() must be called first.
+ * @param[in]	pat Pointer to the player
+ * @param[in]	DMAPATConfigStruct Pointer to a DMAPAT_CFG_Type structure
+ * @return		SUCCESS, or ERROR if DMAPACE_Init() fails: RateHz is 0 or
+ * 				above the timer clock, no channel of the class is free, or the
+ * 				request line is claimed by a UART channel
+ *******************************************************************************/
+Status DMAPAT_Init(DMAPAT_Type* pat, const DMAPAT_CFG_Type* DMAPATConfigStruct)
+{
+    DMAPACE_CFG_Type paceCfg;
+
+    CHECK_PARAM(PARAM_DMAPAT_PORT(DMAPATConfigStruct->Portnum));
+    CHECK_PARAM(PARAM_DMAPAT_TARGET(DMAPATConfigStruct->Target));
+    CHECK_PARAM(PARAM_DMAPAT_LANE(DMAPATConfigStruct->Width, DMAPATConfigStruct->Lane));
+
+    paceCfg.TIMx = DMAPATConfigStruct->TIMx;
+    paceCfg.MatchChannel = DMAPATConfigStruct->MatchChannel;
+    paceCfg.Width = DMAPATConfigStruct->Width;
+    paceCfg.SrcInc = TRUE;
+    paceCfg.DstInc = FALSE;
+    paceCfg.RateHz = DMAPATConfigStruct->RateHz;
+    paceCfg.PrioClass = DMAPATConfigStruct->PrioClass;
+
+    pat->DstAddr = LPC_GPIO_BASE + ((uint32_t)DMAPATConfigStruct->Portnum << 5) + DMAPAT_FIOPIN_OFFSET +
+                   ((uint32_t)DMAPATConfigStruct->Target << 2) + DMAPATConfigStruct->Lane;
+    return DMAPACE_Init(&pat->Pace, &paceCfg);
+}
+
+/*******************************************************************************
+ * @brief		De-initialize a pattern player: stop it and give its channel
+ * 				and request line back
+ * @param[in]	pat Pointer to the player
+ * @return		None
+ *******************************************************************************/
+void DMAPAT_DeInit(DMAPAT_Type* pat)
+{
+    DMAPACE_DeInit(&pat->Pace);
+}
+
+/*******************************************************************************
+ * @brief		Start playing a pattern, from its first word. The linked list
+ * 				items are built here and must stay untouched while playing.
+ * @param[in]	pat Pointer to the player
+ * @param[in]	buffer Port words, of the configured width, in AHB SRAM
+ * @param[in]	length Number of words
+ * @param[in]	lli Linked list items, in AHB SRAM; may be NULL for a pattern
+ * 				of at most DMAPAT_MAX_LLI_WORDS words played once
+ * @param[in]	numLLI Number of items in lli, at least DMAPAT_LLI_COUNT(length)
+ * @param[in]	loop TRUE to repeat the pattern until DMAPAT_Stop()
+ * @return		SUCCESS, or ERROR if the player is busy, length is 0 or
+ * 				there are too few linked list items
+ *******************************************************************************/
+Status DMAPAT_Play(DMAPAT_Type* pat, const void* buffer, uint32_t length, GPDMA_LLI_Type* lli, uint32_t numLLI,
+                   Bool loop)
+{
+    if (loop)
+    {
+        return DMAPACE_Loop(&pat->Pace, (void*)pat->DstAddr, buffer, length, lli, numLLI);
+    }
+    return DMAPACE_Copy(&pat->Pace, (void*)pat->DstAddr, buffer, length, lli, numLLI, NULL, NULL);
+}
+
+/*******************************************************************************
+ * @brief		Stop a pattern. The words already read by the channel are
+ * 				written out first, the port keeps the last word written.
+ * @param[in]	pat Pointer to the player
+ * @return		None
+ *******************************************************************************/
+void DMAPAT_Stop(DMAPAT_Type* pat)
+{
+    DMAPACE_Abort(&pat->Pace);
+}
+
+/*******************************************************************************
+ * @brief		Check whether a pattern is playing
+ * @param[in]	pat Pointer to the player
+ * @return		TRUE while playing; a pattern played once ends by itself
+ * 				after its last word
+ *******************************************************************************/
+Bool DMAPAT_IsBusy(const DMAPAT_Type* pat)
+{
+    return DMAPACE_IsBusy(&pat->Pace);
+}
+
+/**
+ * @}
+ */
+
+#endif /* _DMAPAT */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
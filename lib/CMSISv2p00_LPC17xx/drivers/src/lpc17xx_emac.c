@@ -37,6 +37,7 @@
 
 /* Includes ------------------------------------------------------------------- */
 #include "lpc17xx_emac.h"
+#include "lpc17xx_section.h"
 #include "lpc17xx_clkpwr.h"
 
 /* If this source file built with example, the LPC17xx FW library configuration
@@ -59,31 +60,32 @@
 /* MII Mgmt Configuration register - Clock divider setting */
 const uint8_t EMAC_clkdiv[] = {4, 6, 8, 10, 14, 20, 28, 36, 40, 44, 48, 52, 56, 60, 64};
 
-/* EMAC local DMA Descriptors */
+/* EMAC local DMA Descriptors, in AHB SRAM bank 1: the EMAC DMA cannot
+ * reach local SRAM */
 
 /** Rx Descriptor data array */
-static RX_Desc Rx_Desc[EMAC_NUM_RX_FRAG];
+SECTION_EMAC static RX_Desc Rx_Desc[EMAC_NUM_RX_FRAG];
 
 /** Rx Status data array - Must be 8-Byte aligned */
 #if defined(__CC_ARM)
-static __align(8) RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
+SECTION_EMAC static __align(8) RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
 #elif defined(__ICCARM__)
 #pragma data_alignment = 8
-static RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
+SECTION_EMAC static RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
 #elif defined(__GNUC__)
-static __attribute__((aligned(8))) RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
+SECTION_EMAC static __attribute__((aligned(8))) RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
 #endif
 
 /** Tx Descriptor data array */
-static TX_Desc Tx_Desc[EMAC_NUM_TX_FRAG];
+SECTION_EMAC static TX_Desc Tx_Desc[EMAC_NUM_TX_FRAG];
 /** Tx Status data array */
-static TX_Stat Tx_Stat[EMAC_NUM_TX_FRAG];
+SECTION_EMAC static TX_Stat Tx_Stat[EMAC_NUM_TX_FRAG];
 
 /* EMAC local DMA buffers */
 /** Rx buffer data */
-static uint32_t rx_buf[EMAC_NUM_RX_FRAG][EMAC_ETH_MAX_FLEN >> 2];
+SECTION_EMAC static uint32_t rx_buf[EMAC_NUM_RX_FRAG][EMAC_ETH_MAX_FLEN >> 2];
 /** Tx buffer data */
-static uint32_t tx_buf[EMAC_NUM_TX_FRAG][EMAC_ETH_MAX_FLEN >> 2];
+SECTION_EMAC static uint32_t tx_buf[EMAC_NUM_TX_FRAG][EMAC_ETH_MAX_FLEN >> 2];
 
 /**
  * @}
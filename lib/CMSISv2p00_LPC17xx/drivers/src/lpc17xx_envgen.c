@@ -0,0 +1,400 @@
+/**********************************************************************
+ * $Id$		lpc17xx_envgen.c				2026-10-18
+ *//**
+* @file		lpc17xx_envgen.c
+* @brief	Contains all functions support for DMA-played DAC envelopes
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup ENVGEN
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_envgen.h"
+#include "lpc17xx_dac.h"
+#include "lpc17xx_clkpwr.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _ENVGEN
+
+/* Private Macros ------------------------------------------------------------- */
+/** Control word common to all items, one word per DAC request */
+#define ENVGEN_CONTROL                                                                                      \
+    (GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_1) | GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_1) |                \
+     GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD))
+
+/* Private Variables ---------------------------------------------------------- */
+static ENVGEN_BANK_Type* ENVGEN_Bank;
+static uint32_t ENVGEN_Words;
+static LPC_GPDMACH_TypeDef* ENVGEN_Channel;
+static uint8_t ENVGEN_ChannelNum;
+static uint32_t ENVGEN_Timeout;
+static uint32_t ENVGEN_RateHz;
+static uint32_t ENVGEN_Bias;
+/** Bank playing, and bank linked in by ENVGEN_Update(), equal when none */
+static volatile uint8_t ENVGEN_Active;
+static volatile uint8_t ENVGEN_Pending;
+static volatile uint32_t ENVGEN_Cycles;
+
+/* Private Functions ---------------------------------------------------------- */
+/*******************************************************************************
+ * @brief		Convert a time to a number of DAC updates, rounded
+ * @param[in]	ms Time in milliseconds
+ * @return		Number of samples
+ *******************************************************************************/
+static uint32_t ENVGEN_Samples(uint32_t ms)
+{
+    return (uint32_t)(((uint64_t)ms * ENVGEN_RateHz + 500) / 1000);
+}
+
+/*******************************************************************************
+ * @brief		Append a segment to a chain, in items of at most 4095 samples
+ * @param[in]	bank Bank being compiled
+ * @param[in]	count Number of items so far, updated
+ * @param[in]	src First source word
+ * @param[in]	n Number of samples
+ * @param[in]	inc TRUE to step through the words, FALSE to repeat one
+ * @return		SUCCESS, or ERROR if the bank has too few items
+ *******************************************************************************/
+static Status ENVGEN_Segment(ENVGEN_BANK_Type* bank, uint32_t* count, const uint32_t* src, uint32_t n, Bool inc)
+{
+    uint32_t k = *count;
+    uint32_t chunk;
+
+    while (n)
+    {
+        if (k == ENVGEN_MAX_LLI)
+        {
+            return ERROR;
+        }
+        chunk = (n > 0xFFF) ? 0xFFF : n;
+        bank->Lli[k].SrcAddr = (uint32_t)src;
+        bank->Lli[k].DstAddr = (uint32_t)&LPC_DAC->DACR;
+        bank->Lli[k].NextLLI = (uint32_t)&bank->Lli[k + 1];
+        bank->Lli[k].Control = ENVGEN_CONTROL | GPDMA_DMACCxControl_TransferSize(chunk) |
+                               (inc ? GPDMA_DMACCxControl_SI : 0);
+        if (inc)
+        {
+            src += chunk;
+        }
+        n -= chunk;
+        k++;
+    }
+    *count = k;
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Fill a ramp of n DACR words between two DAC values, the end
+ * 				value excluded
+ * @param[out]	out DACR words
+ * @param[in]	from First value
+ * @param[in]	to End value
+ * @param[in]	n Number of samples
+ * @return		None
+ *******************************************************************************/
+static void ENVGEN_Ramp(uint32_t* out, uint32_t from, uint32_t to, uint32_t n)
+{
+    /* Q16 value and step, the only division */
+    int32_t value = (int32_t)(from << 16);
+    int32_t step = ((int32_t)(to - from) * 65536) / (int32_t)n;
+
+    while (n--)
+    {
+        *out++ = (((uint32_t)(value + 0x8000) >> 16) << 6) | ENVGEN_Bias;
+        value += step;
+    }
+}
+
+/*******************************************************************************
+ * @brief		Compile an envelope into a circular chain
+ * @param[in]	bank Bank to compile into, not being played
+ * @param[in]	param Envelope parameters
+ * @return		SUCCESS, or ERROR if the ramps do not fit the ramp words, the
+ * 				chain needs too many items or the envelope is empty
+ *******************************************************************************/
+static Status ENVGEN_Compile(ENVGEN_BANK_Type* bank, const ENVGEN_PARAM_Type* param)
+{
+    uint32_t max = param->MaxValue & 0x3FF;
+    uint32_t rise = ENVGEN_Samples(param->RiseMs);
+    uint32_t hold = ENVGEN_Samples(param->HoldMs);
+    uint32_t fall = ENVGEN_Samples(param->FallMs);
+    uint32_t settle = ENVGEN_Samples(param->SettleMs);
+    uint32_t count = 0;
+
+    if (rise + fall > ENVGEN_Words)
+    {
+        return ERROR;
+    }
+
+    bank->Level[0] = DAC_VALUE(max) | ENVGEN_Bias;
+    bank->Level[1] = DAC_VALUE(0) | ENVGEN_Bias;
+    if (rise)
+    {
+        ENVGEN_Ramp(bank->Ramp, 0, max, rise);
+    }
+    if (fall)
+    {
+        ENVGEN_Ramp(bank->Ramp + rise, max, 0, fall);
+    }
+
+    if ((ENVGEN_Segment(bank, &count, bank->Ramp, rise, TRUE) == ERROR) ||
+        (ENVGEN_Segment(bank, &count, &bank->Level[0], hold, FALSE) == ERROR) ||
+        (ENVGEN_Segment(bank, &count, bank->Ramp + rise, fall, TRUE) == ERROR) ||
+        (ENVGEN_Segment(bank, &count, &bank->Level[1], settle, FALSE) == ERROR) || (count == 0))
+    {
+        return ERROR;
+    }
+
+    /* Close the loop, one interrupt per cycle */
+    bank->Last = (uint8_t)(count - 1);
+    bank->Lli[count - 1].NextLLI = (uint32_t)&bank->Lli[0];
+    bank->Lli[count - 1].Control |= GPDMA_DMACCxControl_I;
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Check whether the DMA may still read from a bank at an address
+ * @param[in]	bank Bank
+ * @param[in]	addr Source address of the channel
+ * @return		TRUE if addr is one of the words of the bank
+ *******************************************************************************/
+static Bool ENVGEN_Owns(const ENVGEN_BANK_Type* bank, uint32_t addr)
+{
+    /* The ramp end is included, it may be the address left by the last read */
+    if (((addr >= (uint32_t)&bank->Level[0]) && (addr < (uint32_t)&bank->Level[2])) ||
+        ((addr >= (uint32_t)bank->Ramp) && (addr <= (uint32_t)(bank->Ramp + ENVGEN_Words))))
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*******************************************************************************
+ * @brief		Terminal count callback, at the end of every cycle; completes
+ * 				a bank switch once the channel has left the old bank
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Not used
+ * @return		None
+ *******************************************************************************/
+static void ENVGEN_Done(uint8_t channelNum, void* arg)
+{
+    const ENVGEN_BANK_Type* next;
+    uint32_t lli;
+
+    ENVGEN_Cycles++;
+    if (ENVGEN_Pending != ENVGEN_Active)
+    {
+        next = &ENVGEN_Bank[ENVGEN_Pending];
+        lli = ENVGEN_Channel->DMACCLLI;
+        if ((lli >= (uint32_t)&next->Lli[0]) && (lli < (uint32_t)&next->Lli[ENVGEN_MAX_LLI]) &&
+            !ENVGEN_Owns(&ENVGEN_Bank[ENVGEN_Active], ENVGEN_Channel->DMACCSrcAddr))
+        {
+            ENVGEN_Active = ENVGEN_Pending;
+        }
+    }
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup ENVGEN_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the envelope generator: the DAC update rate and a
+ * 				GPDMA channel. DAC_Init() and GPDMA_Init() must be called
+ * 				first, DMA_IRQHandler() must call GPDMA_IntHandler().
+ * @param[in]	ENVGENConfigStruct Pointer to an ENVGEN_CFG_Type structure
+ * @return		SUCCESS, or ERROR if the rate does not fit the DAC timeout
+ * 				counter or no channel is free
+ *******************************************************************************/
+Status ENVGEN_Init(const ENVGEN_CFG_Type* ENVGENConfigStruct)
+{
+    uint32_t pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC);
+    uint32_t timeout;
+    uint8_t ch;
+
+    CHECK_PARAM(PARAM_GPDMA_PRIO(ENVGENConfigStruct->PrioClass));
+
+    if (ENVGENConfigStruct->RateHz == 0)
+    {
+        return ERROR;
+    }
+    timeout = (pclk + ENVGENConfigStruct->RateHz / 2) / ENVGENConfigStruct->RateHz;
+    if ((timeout == 0) || (timeout > 0xFFFF))
+    {
+        return ERROR;
+    }
+
+    ch = GPDMA_ChannelAlloc(ENVGENConfigStruct->PrioClass, FALSE);
+    if (ch == GPDMA_CHANNEL_NONE)
+    {
+        return ERROR;
+    }
+
+    ENVGEN_Timeout = timeout;
+    ENVGEN_RateHz = ENVGENConfigStruct->RateHz;
+    ENVGEN_Bank = ENVGENConfigStruct->Bank;
+    ENVGEN_Words = ENVGENConfigStruct->Words;
+    ENVGEN_Bank[0].Ramp = ENVGENConfigStruct->Buffer;
+    ENVGEN_Bank[1].Ramp = ENVGENConfigStruct->Buffer + ENVGEN_Words;
+    ENVGEN_ChannelNum = ch;
+    ENVGEN_Channel = (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ch * 0x20);
+    ENVGEN_Active = 0;
+    ENVGEN_Pending = 0;
+    GPDMA_SetCallback(ch, ENVGEN_Done, NULL, NULL);
+
+    NVIC_EnableIRQ(DMA_IRQn);
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Compile an envelope and start repeating it, from the rise
+ * @param[in]	param Envelope parameters
+ * @return		SUCCESS, or ERROR if the envelope cannot be compiled
+ *******************************************************************************/
+Status ENVGEN_Start(const ENVGEN_PARAM_Type* param)
+{
+    DAC_CONVERTER_CFG_Type dacCfg;
+    ENVGEN_BANK_Type* bank = &ENVGEN_Bank[0];
+
+    ENVGEN_Bias = LPC_DAC->DACR & DAC_BIAS_EN;
+    if (ENVGEN_Compile(bank, param) == ERROR)
+    {
+        return ERROR;
+    }
+    ENVGEN_Active = 0;
+    ENVGEN_Pending = 0;
+    ENVGEN_Cycles = 0;
+
+    LPC_GPDMA->DMACIntTCClear = GPDMA_DMACIntTCClear_Ch(ENVGEN_ChannelNum);
+    LPC_GPDMA->DMACIntErrClr = GPDMA_DMACIntErrClr_Ch(ENVGEN_ChannelNum);
+    ENVGEN_Channel->DMACCSrcAddr = bank->Lli[0].SrcAddr;
+    ENVGEN_Channel->DMACCDestAddr = bank->Lli[0].DstAddr;
+    ENVGEN_Channel->DMACCLLI = bank->Lli[0].NextLLI;
+    ENVGEN_Channel->DMACCControl = bank->Lli[0].Control;
+    ENVGEN_Channel->DMACCConfig = GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_M2P) |
+                                  GPDMA_DMACCxConfig_DestPeripheral(GPDMA_CONN_DAC) | GPDMA_DMACCxConfig_ITC |
+                                  GPDMA_DMACCxConfig_E;
+
+    DAC_SetDMATimeOut(LPC_DAC, ENVGEN_Timeout);
+    dacCfg.DBLBUF_ENA = 1;
+    dacCfg.CNT_ENA = 1;
+    dacCfg.DMA_ENA = 1;
+    DAC_ConfigDAConverterControl(LPC_DAC, &dacCfg);
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Change the envelope from the next cycle on. The envelope is
+ * 				compiled into the idle bank, which the playing chain then
+ * 				links to at its end.
+ * @param[in]	param Envelope parameters
+ * @return		SUCCESS, or ERROR if the previous update has not taken effect
+ * 				yet or the envelope cannot be compiled
+ *******************************************************************************/
+Status ENVGEN_Update(const ENVGEN_PARAM_Type* param)
+{
+    ENVGEN_BANK_Type* old;
+    ENVGEN_BANK_Type* next;
+    uint32_t idle;
+
+    if (ENVGEN_Pending != ENVGEN_Active)
+    {
+        return ERROR;
+    }
+    idle = ENVGEN_Active ^ 1;
+    old = &ENVGEN_Bank[ENVGEN_Active];
+    next = &ENVGEN_Bank[idle];
+    if (ENVGEN_Compile(next, param) == ERROR)
+    {
+        return ERROR;
+    }
+
+    /* One store redirects the chain; the pending flag first, so that the
+     * callback of this very cycle end can already complete the switch */
+    ENVGEN_Pending = (uint8_t)idle;
+    old->Lli[old->Last].NextLLI = (uint32_t)&next->Lli[0];
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Stop the envelope, the DAC keeps the last sample
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void ENVGEN_Stop(void)
+{
+    LPC_DAC->DACCTRL &= ~(DAC_DMA_ENA | DAC_CNT_ENA);
+    ENVGEN_Channel->DMACCConfig &= ~GPDMA_DMACCxConfig_E;
+    ENVGEN_Pending = ENVGEN_Active;
+}
+
+/*******************************************************************************
+ * @brief		Check whether an update is waiting for the next cycle
+ * @param[in]	None
+ * @return		TRUE until the envelope given to ENVGEN_Update() plays
+ *******************************************************************************/
+Bool ENVGEN_IsPending(void)
+{
+    return (ENVGEN_Pending != ENVGEN_Active) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * @brief		Get the number of complete envelope cycles
+ * @param[in]	None
+ * @return		Cycles since ENVGEN_Start()
+ *******************************************************************************/
+uint32_t ENVGEN_GetCycles(void)
+{
+    return ENVGEN_Cycles;
+}
+
+/*******************************************************************************
+ * @brief		Unpack envelope parameters from a control word: maximum value
+ * 				in bits 7:0, hold in 15:8, rise in 23:16 and fall in 31:24, in
+ * 				ms; the settle time is the hold time. As in p2018 ej1, rise
+ * 				and fall are the time of one DAC step, so a ramp lasts the
+ * 				maximum value times as long, up to 255 * 255 ms; its samples
+ * 				must fit the ramp words at the configured rate.
+ * @param[in]	control Control word
+ * @param[out]	param Envelope parameters
+ * @return		None
+ *******************************************************************************/
+void ENVGEN_Unpack(uint32_t control, ENVGEN_PARAM_Type* param)
+{
+    param->MaxValue = (uint16_t)(control & 0xFF);
+    param->HoldMs = (uint16_t)((control >> 8) & 0xFF);
+    param->RiseMs = (uint16_t)(((control >> 16) & 0xFF) * param->MaxValue);
+    param->FallMs = (uint16_t)((control >> 24) * param->MaxValue);
+    param->SettleMs = param->HoldMs;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _ENVGEN */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
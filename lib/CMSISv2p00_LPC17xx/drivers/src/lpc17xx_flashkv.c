@@ -0,0 +1,505 @@
+/**********************************************************************
+ * $Id$		lpc17xx_flashkv.c				2026-10-18
+ *//**
+* @file		lpc17xx_flashkv.c
+* @brief	Contains all functions support for the wear-leveled flash
+* 			key/value store on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup FLASHKV
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_flashkv.h"
+#include "lpc17xx_iap.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _FLASHKV
+
+/* Private Macros ------------------------------------------------------------- */
+/** Number of bytes covered by the record CRC */
+#define FLASHKV_CRC_LEN (FLASHKV_RECORD_SIZE - 4)
+
+/* Private Variables ---------------------------------------------------------- */
+/** Latest record of each key, in flash or in the staging page. NULL if unset */
+static const FLASHKV_Record_Type* FLASHKV_Index[FLASHKV_MAX_KEYS];
+/** Records waiting for the next page write */
+static FLASHKV_Record_Type FLASHKV_Staging[FLASHKV_RECORDS_PER_PAGE];
+/** Page buffer used during compaction */
+static FLASHKV_Record_Type FLASHKV_Packing[FLASHKV_RECORDS_PER_PAGE];
+static uint32_t FLASHKV_Staged;
+
+static uint32_t FLASHKV_FirstSector;
+static uint32_t FLASHKV_NumSectors;
+static uint32_t FLASHKV_SectorSize;
+static uint32_t FLASHKV_Active;     /**< Active sector, 0..NumSectors-1 */
+static uint32_t FLASHKV_Generation; /**< Header sequence of the active sector */
+static uint32_t FLASHKV_NextPage;   /**< Address of the next blank page */
+
+/** CRC-32 (0xEDB88320) nibble table */
+static const uint32_t FLASHKV_CrcTable[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+/* Private Functions ---------------------------------------------------------- */
+static uint32_t FLASHKV_Crc(const uint8_t* data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    while (length--)
+    {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ FLASHKV_CrcTable[crc & 0x0F];
+        crc = (crc >> 4) ^ FLASHKV_CrcTable[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+static Bool FLASHKV_RecordValid(const FLASHKV_Record_Type* rec)
+{
+    if (rec->Key == FLASHKV_KEY_BLANK)
+    {
+        return FALSE;
+    }
+    return (rec->Crc == FLASHKV_Crc((const uint8_t*)rec, FLASHKV_CRC_LEN)) ? TRUE : FALSE;
+}
+
+static void FLASHKV_ClearPage(FLASHKV_Record_Type* page)
+{
+    uint32_t* word = (uint32_t*)page;
+    uint32_t i;
+
+    for (i = 0; i < FLASHKV_PAGE_SIZE / 4; i++)
+    {
+        word[i] = 0xFFFFFFFF;
+    }
+}
+
+static Bool FLASHKV_PageBlank(uint32_t addr)
+{
+    const uint32_t* word = (const uint32_t*)addr;
+    uint32_t i;
+
+    for (i = 0; i < FLASHKV_PAGE_SIZE / 4; i++)
+    {
+        if (word[i] != 0xFFFFFFFF)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/** IAP sector number to address, inverse of GetSecNum() */
+static uint32_t FLASHKV_SectorAddr(uint32_t index)
+{
+    uint32_t sec = FLASHKV_FirstSector + index;
+
+    if (sec < 16)
+    {
+        return sec << 12;
+    }
+    return 0x00010000 + ((sec - 16) << 15);
+}
+
+/** Flash is not readable while IAP runs, so no interrupt may fetch from it */
+static Status FLASHKV_Program(uint32_t dest, const FLASHKV_Record_Type* page)
+{
+    IAP_STATUS_CODE status;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    status = CopyRAM2Flash((uint8_t*)dest, (uint8_t*)page, IAP_WRITE_256);
+    __set_PRIMASK(primask);
+
+    return (status == CMD_SUCCESS) ? SUCCESS : ERROR;
+}
+
+static Status FLASHKV_Erase(uint32_t index)
+{
+    IAP_STATUS_CODE status;
+    uint32_t primask = __get_PRIMASK();
+    uint32_t sec = FLASHKV_FirstSector + index;
+
+    __disable_irq();
+    status = EraseSector(sec, sec);
+    __set_PRIMASK(primask);
+
+    return (status == CMD_SUCCESS) ? SUCCESS : ERROR;
+}
+
+static void FLASHKV_FillRecord(FLASHKV_Record_Type* rec, uint16_t key, const void* value, uint8_t length)
+{
+    const uint8_t* src = (const uint8_t*)value;
+    uint8_t i;
+
+    rec->Key = key;
+    rec->Length = length;
+    rec->Reserved = 0xFF;
+    for (i = 0; i < FLASHKV_MAX_VALUE_LEN; i++)
+    {
+        rec->Data[i] = ((length != FLASHKV_LEN_TOMBSTONE) && (i < length)) ? src[i] : 0xFF;
+    }
+    rec->Crc = FLASHKV_Crc((const uint8_t*)rec, FLASHKV_CRC_LEN);
+}
+
+/** Write the header page of a sector, marking it as the newest one */
+static Status FLASHKV_WriteHeader(uint32_t index, uint32_t generation)
+{
+    uint32_t hdr[2];
+
+    hdr[0] = FLASHKV_MAGIC;
+    hdr[1] = generation;
+    FLASHKV_ClearPage(FLASHKV_Packing);
+    FLASHKV_FillRecord(&FLASHKV_Packing[0], FLASHKV_KEY_HEADER, hdr, sizeof(hdr));
+
+    return FLASHKV_Program(FLASHKV_SectorAddr(index), FLASHKV_Packing);
+}
+
+/** Rebuild the index from the records of the active sector */
+static void FLASHKV_Scan(void)
+{
+    const FLASHKV_Record_Type* rec;
+    uint32_t base = FLASHKV_SectorAddr(FLASHKV_Active);
+    uint32_t end = base + FLASHKV_SectorSize;
+    uint32_t page, i;
+
+    for (i = 0; i < FLASHKV_MAX_KEYS; i++)
+    {
+        FLASHKV_Index[i] = NULL;
+    }
+
+    /* Pages are appended in order, the first blank one ends the log */
+    for (page = base + FLASHKV_PAGE_SIZE; page < end; page += FLASHKV_PAGE_SIZE)
+    {
+        if (FLASHKV_PageBlank(page))
+        {
+            break;
+        }
+        rec = (const FLASHKV_Record_Type*)page;
+        for (i = 0; i < FLASHKV_RECORDS_PER_PAGE; i++, rec++)
+        {
+            /* Torn or corrupted records are skipped, the previous value stays */
+            if (!FLASHKV_RecordValid(rec) || !PARAM_FLASHKV_KEY(rec->Key))
+            {
+                continue;
+            }
+            FLASHKV_Index[rec->Key] = (rec->Length == FLASHKV_LEN_TOMBSTONE) ? NULL : rec;
+        }
+    }
+    FLASHKV_NextPage = page;
+}
+
+/** Copy the live records into the next sector and make it the active one */
+static Status FLASHKV_Compact(void)
+{
+    uint32_t target = (FLASHKV_Active + 1) % FLASHKV_NumSectors;
+    uint32_t base = FLASHKV_SectorAddr(target);
+    uint32_t end = base + FLASHKV_SectorSize;
+    uint32_t page = base + FLASHKV_PAGE_SIZE;
+    uint32_t n = 0;
+    uint32_t key;
+
+    if (FLASHKV_Erase(target) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    /* Pack the live records, staged ones included, 8 per page */
+    FLASHKV_ClearPage(FLASHKV_Packing);
+    for (key = 0; key < FLASHKV_MAX_KEYS; key++)
+    {
+        if (FLASHKV_Index[key] == NULL)
+        {
+            continue;
+        }
+        FLASHKV_Packing[n++] = *FLASHKV_Index[key];
+        if (n == FLASHKV_RECORDS_PER_PAGE)
+        {
+            if ((page >= end) || (FLASHKV_Program(page, FLASHKV_Packing) != SUCCESS))
+            {
+                return ERROR;
+            }
+            page += FLASHKV_PAGE_SIZE;
+            n = 0;
+            FLASHKV_ClearPage(FLASHKV_Packing);
+        }
+    }
+    if (n != 0)
+    {
+        if ((page >= end) || (FLASHKV_Program(page, FLASHKV_Packing) != SUCCESS))
+        {
+            return ERROR;
+        }
+    }
+
+    /* Header last: until here the old sector is still the valid one */
+    if (FLASHKV_WriteHeader(target, FLASHKV_Generation + 1) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    FLASHKV_Active = target;
+    FLASHKV_Generation++;
+    FLASHKV_ClearPage(FLASHKV_Staging);
+    FLASHKV_Staged = 0;
+    FLASHKV_Scan();
+
+    return SUCCESS;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup FLASHKV_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the store: find the newest valid sector and build
+ * 				the RAM index from its records. If no sector holds a valid
+ * 				header, the first one is erased and formatted.
+ * @param[in]	FLASHKVConfigStruct Pointer to a FLASHKV_CFG_Type structure
+ * 				with the sectors reserved for the store. They must not hold
+ * 				code and must be the same on every boot.
+ * @return		SUCCESS or ERROR if formatting failed
+ *******************************************************************************/
+Status FLASHKV_Init(const FLASHKV_CFG_Type* FLASHKVConfigStruct)
+{
+    const FLASHKV_Record_Type* hdr;
+    const uint32_t* data;
+    Bool found = FALSE;
+    uint32_t i;
+
+    CHECK_PARAM(PARAM_FLASHKV_SECTORS(FLASHKVConfigStruct->FirstSector, FLASHKVConfigStruct->NumSectors));
+
+    FLASHKV_FirstSector = FLASHKVConfigStruct->FirstSector;
+    FLASHKV_NumSectors = FLASHKVConfigStruct->NumSectors;
+    FLASHKV_SectorSize = (FLASHKV_FirstSector < 16) ? 0x1000 : 0x8000;
+    FLASHKV_ClearPage(FLASHKV_Staging);
+    FLASHKV_Staged = 0;
+
+    for (i = 0; i < FLASHKV_NumSectors; i++)
+    {
+        hdr = (const FLASHKV_Record_Type*)FLASHKV_SectorAddr(i);
+        data = (const uint32_t*)hdr->Data;
+        if ((hdr->Key != FLASHKV_KEY_HEADER) || !FLASHKV_RecordValid(hdr) || (data[0] != FLASHKV_MAGIC))
+        {
+            continue;
+        }
+        if (!found || (data[1] > FLASHKV_Generation))
+        {
+            FLASHKV_Active = i;
+            FLASHKV_Generation = data[1];
+            found = TRUE;
+        }
+    }
+
+    if (!found)
+    {
+        FLASHKV_Active = 0;
+        FLASHKV_Generation = 1;
+        if ((FLASHKV_Erase(0) != SUCCESS) || (FLASHKV_WriteHeader(0, FLASHKV_Generation) != SUCCESS))
+        {
+            return ERROR;
+        }
+    }
+
+    FLASHKV_Scan();
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Set the value of a key. The record is staged in RAM and is
+ * 				visible to FLASHKV_Get() immediately, it is written to flash
+ * 				by FLASHKV_Commit() or when the staging page is full.
+ * @param[in]	key Key, should be < FLASHKV_MAX_KEYS
+ * @param[in]	value Pointer to the value
+ * @param[in]	length Value length, should be <= FLASHKV_MAX_VALUE_LEN
+ * @return		SUCCESS or ERROR if a required flash write failed
+ *******************************************************************************/
+Status FLASHKV_Set(uint16_t key, const void* value, uint8_t length)
+{
+    FLASHKV_Record_Type* rec = NULL;
+    uint32_t i;
+
+    CHECK_PARAM(PARAM_FLASHKV_KEY(key));
+    CHECK_PARAM(PARAM_FLASHKV_LEN(length) || (length == FLASHKV_LEN_TOMBSTONE));
+
+    /* A page holds each key at most once, so later pages always win */
+    for (i = 0; i < FLASHKV_Staged; i++)
+    {
+        if (FLASHKV_Staging[i].Key == key)
+        {
+            rec = &FLASHKV_Staging[i];
+            break;
+        }
+    }
+    if (rec == NULL)
+    {
+        if ((FLASHKV_Staged == FLASHKV_RECORDS_PER_PAGE) && (FLASHKV_Commit() != SUCCESS))
+        {
+            return ERROR;
+        }
+        rec = &FLASHKV_Staging[FLASHKV_Staged++];
+    }
+
+    FLASHKV_FillRecord(rec, key, value, length);
+    FLASHKV_Index[key] = (length == FLASHKV_LEN_TOMBSTONE) ? NULL : rec;
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Delete a key, staged like FLASHKV_Set()
+ * @param[in]	key Key, should be < FLASHKV_MAX_KEYS
+ * @return		SUCCESS or ERROR if a required flash write failed
+ *******************************************************************************/
+Status FLASHKV_Delete(uint16_t key)
+{
+    return FLASHKV_Set(key, NULL, FLASHKV_LEN_TOMBSTONE);
+}
+
+/*******************************************************************************
+ * @brief		Write the staged records to the next blank page. A page left
+ * 				torn by a failed write is skipped, its records fail their CRC,
+ * 				and the next page is tried. If the active sector is full, the
+ * 				live records are compacted into the next sector of the ring
+ * 				instead. Interrupts are masked while IAP programs or erases
+ * 				the flash.
+ * @param[in]	None
+ * @return		SUCCESS or ERROR, staged records are kept on ERROR
+ *******************************************************************************/
+Status FLASHKV_Commit(void)
+{
+    const FLASHKV_Record_Type* rec;
+    uint32_t end = FLASHKV_SectorAddr(FLASHKV_Active) + FLASHKV_SectorSize;
+    uint32_t i;
+
+    if (FLASHKV_Staged == 0)
+    {
+        return SUCCESS;
+    }
+
+    for (; FLASHKV_NextPage < end; FLASHKV_NextPage += FLASHKV_PAGE_SIZE)
+    {
+        if (FLASHKV_Program(FLASHKV_NextPage, FLASHKV_Staging) == SUCCESS)
+        {
+            break;
+        }
+        /* A blank page ends the log for FLASHKV_Scan(), nothing may be
+           written past it: keep it for the next try */
+        if (FLASHKV_PageBlank(FLASHKV_NextPage))
+        {
+            return ERROR;
+        }
+    }
+    if (FLASHKV_NextPage >= end)
+    {
+        return FLASHKV_Compact();
+    }
+
+    /* Move the index from the staging page to the written page */
+    rec = (const FLASHKV_Record_Type*)FLASHKV_NextPage;
+    for (i = 0; i < FLASHKV_Staged; i++)
+    {
+        if (FLASHKV_Index[FLASHKV_Staging[i].Key] == &FLASHKV_Staging[i])
+        {
+            FLASHKV_Index[FLASHKV_Staging[i].Key] = &rec[i];
+        }
+    }
+    FLASHKV_NextPage += FLASHKV_PAGE_SIZE;
+    FLASHKV_ClearPage(FLASHKV_Staging);
+    FLASHKV_Staged = 0;
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Get a pointer to the value of a key, O(1)
+ * @param[in]	key Key, should be < FLASHKV_MAX_KEYS
+ * @param[out]	length Value length, may be NULL
+ * @return		Pointer to the value (flash or staging page), NULL if unset
+ *******************************************************************************/
+const uint8_t* FLASHKV_GetPtr(uint16_t key, uint8_t* length)
+{
+    const FLASHKV_Record_Type* rec;
+
+    CHECK_PARAM(PARAM_FLASHKV_KEY(key));
+
+    rec = FLASHKV_Index[key];
+    if (rec == NULL)
+    {
+        return NULL;
+    }
+    if (length != NULL)
+    {
+        *length = rec->Length;
+    }
+    return rec->Data;
+}
+
+/*******************************************************************************
+ * @brief		Copy the value of a key, O(1)
+ * @param[in]	key Key, should be < FLASHKV_MAX_KEYS
+ * @param[out]	value Buffer of at least FLASHKV_MAX_VALUE_LEN bytes
+ * @param[out]	length Value length, may be NULL
+ * @return		SUCCESS or ERROR if the key is unset
+ *******************************************************************************/
+Status FLASHKV_Get(uint16_t key, void* value, uint8_t* length)
+{
+    const uint8_t* src;
+    uint8_t* dst = (uint8_t*)value;
+    uint8_t len, i;
+
+    src = FLASHKV_GetPtr(key, &len);
+    if (src == NULL)
+    {
+        return ERROR;
+    }
+    for (i = 0; i < len; i++)
+    {
+        dst[i] = src[i];
+    }
+    if (length != NULL)
+    {
+        *length = len;
+    }
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Get the generation of the active sector. It is incremented on
+ * 				every compaction, so each sector has been erased about
+ * 				generation / NumSectors times.
+ * @param[in]	None
+ * @return		Generation number
+ *******************************************************************************/
+uint32_t FLASHKV_GetGeneration(void)
+{
+    return FLASHKV_Generation;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _FLASHKV */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
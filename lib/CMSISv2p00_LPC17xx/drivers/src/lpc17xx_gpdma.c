@@ -188,6 +188,88 @@ const uint8_t GPDMA_LUTPerWid[] = {
     GPDMA_WIDTH_WORD  // MAT3.1
 };
 
+/** Allocated channels */
+static uint8_t GPDMA_ChAlloc;
+/** Allocated channels freed when their transfer ends */
+static uint8_t GPDMA_ChAuto;
+/** Auto freed channels enabled since their allocation */
+static uint8_t GPDMA_ChArmed;
+/** Connections (bit n for connection n) claimed by each channel */
+static uint32_t GPDMA_ChReq[8];
+/** Number of claims on each DMAREQSEL line */
+static uint8_t GPDMA_ReqRef[8];
+/** Terminal count callbacks, by channel */
+static GPDMA_Callback GPDMA_TCCallback[8];
+/** Error callbacks, by channel */
+static GPDMA_Callback GPDMA_ErrCallback[8];
+/** Callback arguments, by channel */
+static void* GPDMA_CallbackArg[8];
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup GPDMA_Private_Functions GPDMA Private Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Release the DMAREQSEL lines claimed by a channel
+ * @param[in]	channelNum	GPDMA channel, should be in range from 0 to 7
+ * @return		None
+ **********************************************************************/
+static void gpdma_ReleaseReqSel(uint8_t channelNum)
+{
+    uint32_t conn;
+
+    for (conn = GPDMA_CONN_UART0_Tx; conn <= GPDMA_CONN_MAT3_1; conn++)
+    {
+        if (GPDMA_ChReq[channelNum] & (1UL << conn))
+        {
+            GPDMA_ReqRef[conn & 0x07]--;
+        }
+    }
+    GPDMA_ChReq[channelNum] = 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		Free a channel: its allocation, DMAREQSEL claims and
+ * 				callbacks. Interrupts must be disabled by the caller.
+ * @param[in]	channelNum	GPDMA channel, should be in range from 0 to 7
+ * @return		None
+ **********************************************************************/
+static void gpdma_FreeLocked(uint8_t channelNum)
+{
+    gpdma_ReleaseReqSel(channelNum);
+    GPDMA_TCCallback[channelNum] = NULL;
+    GPDMA_ErrCallback[channelNum] = NULL;
+    GPDMA_CallbackArg[channelNum] = NULL;
+    GPDMA_ChAlloc &= ~(1 << channelNum);
+    GPDMA_ChAuto &= ~(1 << channelNum);
+    GPDMA_ChArmed &= ~(1 << channelNum);
+}
+
+/*********************************************************************/ /**
+ * @brief		Free the auto freed channels whose transfer has ended.
+ * 				Interrupts must be disabled by the caller.
+ * @param[in]	None
+ * @return		None
+ **********************************************************************/
+static void gpdma_FreeDone(void)
+{
+    uint8_t done = GPDMA_ChArmed & ~LPC_GPDMA->DMACEnbldChns;
+    uint8_t ch;
+
+    for (ch = 0; ch < 8; ch++)
+    {
+        if (done & (1 << ch))
+        {
+            gpdma_FreeLocked(ch);
+        }
+    }
+}
+
 /**
  * @}
  */
@@ -204,6 +286,8 @@ const uint8_t GPDMA_LUTPerWid[] = {
                                                                         *********************************************************************/
 void GPDMA_Init(void)
 {
+    uint32_t i;
+
     /* Enable GPDMA clock */
     CLKPWR_ConfigPPWR(CLKPWR_PCONP_PCGPDMA, ENABLE);
 
@@ -220,6 +304,23 @@ void GPDMA_Init(void)
     /* Clear all DMA interrupt and error flag */
     LPC_GPDMA->DMACIntTCClear = 0xFF;
     LPC_GPDMA->DMACIntErrClr = 0xFF;
+
+    /* Enable DMA channels, little endian, once for every driver */
+    LPC_GPDMA->DMACConfig = GPDMA_DMACConfig_E;
+    while (!(LPC_GPDMA->DMACConfig & GPDMA_DMACConfig_E))
+        ;
+
+    /* Forget all channel allocations and request line claims */
+    GPDMA_ChAlloc = 0;
+    GPDMA_ChAuto = 0;
+    GPDMA_ChArmed = 0;
+    for (i = 0; i < 8; i++)
+    {
+        GPDMA_ChReq[i] = 0;
+        GPDMA_ReqRef[i] = 0;
+        GPDMA_TCCallback[i] = NULL;
+        GPDMA_ErrCallback[i] = NULL;
+    }
 }
 
 /********************************************************************/ /**
@@ -237,7 +338,7 @@ void GPDMA_Init(void)
 Status GPDMA_Setup(GPDMA_Channel_CFG_Type* GPDMAChannelConfig)
 {
     LPC_GPDMACH_TypeDef* pDMAch;
-    uint32_t tmp1, tmp2;
+    GPDMA_PROGRAM_Type program;
 
     if (LPC_GPDMA->DMACEnbldChns & (GPDMA_DMACEnbldChns_Ch(GPDMAChannelConfig->ChannelNum)))
     {
@@ -245,6 +346,12 @@ Status GPDMA_Setup(GPDMA_Channel_CFG_Type* GPDMAChannelConfig)
         return ERROR;
     }
 
+    // Do not support any more transfer type, return ERROR
+    if (GPDMA_Compile(GPDMAChannelConfig, &program) == ERROR)
+    {
+        return ERROR;
+    }
+
     // Get Channel pointer
     pDMAch = (LPC_GPDMACH_TypeDef*)pGPDMACh[GPDMAChannelConfig->ChannelNum];
 
@@ -256,31 +363,83 @@ Status GPDMA_Setup(GPDMA_Channel_CFG_Type* GPDMAChannelConfig)
     pDMAch->DMACCControl = 0x00;
     pDMAch->DMACCConfig = 0x00;
 
-    /* Assign Linker List Item value */
-    pDMAch->DMACCLLI = GPDMAChannelConfig->DMALLI;
+    /* Re-Configure DMA Request Select for the peripherals used. Only
+     * connections 8 to 23 are muxed; a line still claimed by another channel
+     * for the other peripheral is an error */
+    gpdma_ReleaseReqSel(GPDMAChannelConfig->ChannelNum);
+    if ((GPDMAChannelConfig->TransferType == GPDMA_TRANSFERTYPE_P2M) ||
+        (GPDMAChannelConfig->TransferType == GPDMA_TRANSFERTYPE_P2P))
+    {
+        if (GPDMA_ReqSelClaim(GPDMAChannelConfig->ChannelNum, GPDMAChannelConfig->SrcConn) == ERROR)
+        {
+            return ERROR;
+        }
+    }
+    if ((GPDMAChannelConfig->TransferType == GPDMA_TRANSFERTYPE_M2P) ||
+        (GPDMAChannelConfig->TransferType == GPDMA_TRANSFERTYPE_P2P))
+    {
+        if (GPDMA_ReqSelClaim(GPDMAChannelConfig->ChannelNum, GPDMAChannelConfig->DstConn) == ERROR)
+        {
+            gpdma_ReleaseReqSel(GPDMAChannelConfig->ChannelNum);
+            return ERROR;
+        }
+    }
+
+    /* Enable DMA channels, little endian */
+    LPC_GPDMA->DMACConfig = GPDMA_DMACConfig_E;
+    while (!(LPC_GPDMA->DMACConfig & GPDMA_DMACConfig_E))
+        ;
+
+    /* Assign Linker List Item value, addresses and control */
+    pDMAch->DMACCLLI = program.LLI;
+    pDMAch->DMACCSrcAddr = program.SrcAddr;
+    pDMAch->DMACCDestAddr = program.DstAddr;
+    pDMAch->DMACCControl = program.Control;
+
+    // Configure DMA Channel, enable Error Counter and Terminate counter
+    pDMAch->DMACCConfig = program.Config;
+
+    return SUCCESS;
+}
 
-    /* Set value to Channel Control Registers */
+/*********************************************************************/ /**
+ * @brief		Compile a channel configuration into a program: the register
+ * 				values GPDMA_Setup() writes, computed once. The program does
+ * 				not depend on ChannelNum and can arm any channel.
+ * @param[in]	GPDMAChannelConfig	Pointer to a GPDMA_Channel_CFG_Type
+ * 					structure, as for GPDMA_Setup()
+ * @param[out]	GPDMAProgram		Pointer to the program
+ * @return		ERROR if the transfer type is not supported, otherwise
+ * 				SUCCESS
+ **********************************************************************/
+Status GPDMA_Compile(const GPDMA_Channel_CFG_Type* GPDMAChannelConfig, GPDMA_PROGRAM_Type* GPDMAProgram)
+{
+    uint32_t tmp1, tmp2;
+
+    GPDMAProgram->LLI = GPDMAChannelConfig->DMALLI;
+
+    /* Control word */
     switch (GPDMAChannelConfig->TransferType)
     {
         // Memory to memory
         case GPDMA_TRANSFERTYPE_M2M:
             // Assign physical source and destination address
-            pDMAch->DMACCSrcAddr = GPDMAChannelConfig->SrcMemAddr;
-            pDMAch->DMACCDestAddr = GPDMAChannelConfig->DstMemAddr;
-            pDMAch->DMACCControl = GPDMA_DMACCxControl_TransferSize(GPDMAChannelConfig->TransferSize) |
-                                   GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_32) |
-                                   GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_32) |
-                                   GPDMA_DMACCxControl_SWidth(GPDMAChannelConfig->TransferWidth) |
-                                   GPDMA_DMACCxControl_DWidth(GPDMAChannelConfig->TransferWidth) |
-                                   GPDMA_DMACCxControl_SI | GPDMA_DMACCxControl_DI | GPDMA_DMACCxControl_I;
+            GPDMAProgram->SrcAddr = GPDMAChannelConfig->SrcMemAddr;
+            GPDMAProgram->DstAddr = GPDMAChannelConfig->DstMemAddr;
+            GPDMAProgram->Control = GPDMA_DMACCxControl_TransferSize(GPDMAChannelConfig->TransferSize) |
+                                    GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_32) |
+                                    GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_32) |
+                                    GPDMA_DMACCxControl_SWidth(GPDMAChannelConfig->TransferWidth) |
+                                    GPDMA_DMACCxControl_DWidth(GPDMAChannelConfig->TransferWidth) |
+                                    GPDMA_DMACCxControl_SI | GPDMA_DMACCxControl_DI | GPDMA_DMACCxControl_I;
             break;
         // Memory to peripheral
         case GPDMA_TRANSFERTYPE_M2P:
             // Assign physical source
-            pDMAch->DMACCSrcAddr = GPDMAChannelConfig->SrcMemAddr;
+            GPDMAProgram->SrcAddr = GPDMAChannelConfig->SrcMemAddr;
             // Assign peripheral destination address
-            pDMAch->DMACCDestAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->DstConn];
-            pDMAch->DMACCControl =
+            GPDMAProgram->DstAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->DstConn];
+            GPDMAProgram->Control =
                 GPDMA_DMACCxControl_TransferSize((uint32_t)GPDMAChannelConfig->TransferSize) |
                 GPDMA_DMACCxControl_SBSize((uint32_t)GPDMA_LUTPerBurst[GPDMAChannelConfig->DstConn]) |
                 GPDMA_DMACCxControl_DBSize((uint32_t)GPDMA_LUTPerBurst[GPDMAChannelConfig->DstConn]) |
@@ -291,10 +450,10 @@ Status GPDMA_Setup(GPDMA_Channel_CFG_Type* GPDMAChannelConfig)
         // Peripheral to memory
         case GPDMA_TRANSFERTYPE_P2M:
             // Assign peripheral source address
-            pDMAch->DMACCSrcAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->SrcConn];
+            GPDMAProgram->SrcAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->SrcConn];
             // Assign memory destination address
-            pDMAch->DMACCDestAddr = GPDMAChannelConfig->DstMemAddr;
-            pDMAch->DMACCControl =
+            GPDMAProgram->DstAddr = GPDMAChannelConfig->DstMemAddr;
+            GPDMAProgram->Control =
                 GPDMA_DMACCxControl_TransferSize((uint32_t)GPDMAChannelConfig->TransferSize) |
                 GPDMA_DMACCxControl_SBSize((uint32_t)GPDMA_LUTPerBurst[GPDMAChannelConfig->SrcConn]) |
                 GPDMA_DMACCxControl_DBSize((uint32_t)GPDMA_LUTPerBurst[GPDMAChannelConfig->SrcConn]) |
@@ -305,10 +464,10 @@ Status GPDMA_Setup(GPDMA_Channel_CFG_Type* GPDMAChannelConfig)
         // Peripheral to peripheral
         case GPDMA_TRANSFERTYPE_P2P:
             // Assign peripheral source address
-            pDMAch->DMACCSrcAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->SrcConn];
+            GPDMAProgram->SrcAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->SrcConn];
             // Assign peripheral destination address
-            pDMAch->DMACCDestAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->DstConn];
-            pDMAch->DMACCControl =
+            GPDMAProgram->DstAddr = (uint32_t)GPDMA_LUTPerAddr[GPDMAChannelConfig->DstConn];
+            GPDMAProgram->Control =
                 GPDMA_DMACCxControl_TransferSize((uint32_t)GPDMAChannelConfig->TransferSize) |
                 GPDMA_DMACCxControl_SBSize((uint32_t)GPDMA_LUTPerBurst[GPDMAChannelConfig->SrcConn]) |
                 GPDMA_DMACCxControl_DBSize((uint32_t)GPDMA_LUTPerBurst[GPDMAChannelConfig->DstConn]) |
@@ -320,45 +479,46 @@ Status GPDMA_Setup(GPDMA_Channel_CFG_Type* GPDMAChannelConfig)
         default: return ERROR;
     }
 
-    /* Re-Configure DMA Request Select for source peripheral */
-    if (GPDMAChannelConfig->SrcConn > 15)
-    {
-        LPC_SC->DMAREQSEL |= (1 << (GPDMAChannelConfig->SrcConn - 16));
-    }
-    else
-    {
-        LPC_SC->DMAREQSEL &= ~(1 << (GPDMAChannelConfig->SrcConn - 8));
-    }
-
-    /* Re-Configure DMA Request Select for Destination peripheral */
-    if (GPDMAChannelConfig->DstConn > 15)
-    {
-        LPC_SC->DMAREQSEL |= (1 << (GPDMAChannelConfig->DstConn - 16));
-    }
-    else
-    {
-        LPC_SC->DMAREQSEL &= ~(1 << (GPDMAChannelConfig->DstConn - 8));
-    }
-
-    /* Enable DMA channels, little endian */
-    LPC_GPDMA->DMACConfig = GPDMA_DMACConfig_E;
-    while (!(LPC_GPDMA->DMACConfig & GPDMA_DMACConfig_E))
-        ;
-
     // Calculate absolute value for Connection number
     tmp1 = GPDMAChannelConfig->SrcConn;
     tmp1 = ((tmp1 > 15) ? (tmp1 - 8) : tmp1);
     tmp2 = GPDMAChannelConfig->DstConn;
     tmp2 = ((tmp2 > 15) ? (tmp2 - 8) : tmp2);
 
-    // Configure DMA Channel, enable Error Counter and Terminate counter
-    pDMAch->DMACCConfig = GPDMA_DMACCxConfig_IE | GPDMA_DMACCxConfig_ITC /*| GPDMA_DMACCxConfig_E*/
-                          | GPDMA_DMACCxConfig_TransferType((uint32_t)GPDMAChannelConfig->TransferType) |
-                          GPDMA_DMACCxConfig_SrcPeripheral(tmp1) | GPDMA_DMACCxConfig_DestPeripheral(tmp2);
+    // Channel configuration, enable Error Counter and Terminate counter, channel disabled
+    GPDMAProgram->Config = GPDMA_DMACCxConfig_IE | GPDMA_DMACCxConfig_ITC |
+                           GPDMA_DMACCxConfig_TransferType((uint32_t)GPDMAChannelConfig->TransferType) |
+                           GPDMA_DMACCxConfig_SrcPeripheral(tmp1) | GPDMA_DMACCxConfig_DestPeripheral(tmp2);
 
     return SUCCESS;
 }
 
+/*********************************************************************/ /**
+ * @brief		Arm and enable a channel from a compiled program: five
+ * 				register writes and the flag clear, no table lookups and no
+ * 				DMACConfig polling. The controller must be enabled and the
+ * 				DMAREQSEL lines claimed, e.g. by a first GPDMA_Setup() of the
+ * 				channel or by GPDMA_ReqSelClaim(). The channel must be idle.
+ * @param[in]	channelNum		GPDMA channel, should be in range from 0 to 7
+ * @param[in]	GPDMAProgram	Pointer to the program
+ * @return		None
+ **********************************************************************/
+void GPDMA_Arm(uint8_t channelNum, const GPDMA_PROGRAM_Type* GPDMAProgram)
+{
+    LPC_GPDMACH_TypeDef* pDMAch = (LPC_GPDMACH_TypeDef*)pGPDMACh[channelNum];
+
+    CHECK_PARAM(PARAM_GPDMA_CHANNEL(channelNum));
+
+    LPC_GPDMA->DMACIntTCClear = GPDMA_DMACIntTCClear_Ch(channelNum);
+    LPC_GPDMA->DMACIntErrClr = GPDMA_DMACIntErrClr_Ch(channelNum);
+    pDMAch->DMACCSrcAddr = GPDMAProgram->SrcAddr;
+    pDMAch->DMACCDestAddr = GPDMAProgram->DstAddr;
+    pDMAch->DMACCLLI = GPDMAProgram->LLI;
+    pDMAch->DMACCControl = GPDMAProgram->Control;
+    GPDMA_ChArmed |= GPDMA_ChAuto & (1 << channelNum);
+    pDMAch->DMACCConfig = GPDMAProgram->Config | GPDMA_DMACCxConfig_E;
+}
+
 /*********************************************************************/ /**
                                                                          * @brief		Enable/Disable DMA channel
                                                                          * @param[in]	channelNum	GPDMA channel, should
@@ -378,6 +538,7 @@ void GPDMA_ChannelCmd(uint8_t channelNum, FunctionalState NewState)
 
     if (NewState == ENABLE)
     {
+        GPDMA_ChArmed |= GPDMA_ChAuto & (1 << channelNum);
         pDMAch->DMACCConfig |= GPDMA_DMACCxConfig_E;
     }
     else
@@ -469,6 +630,212 @@ void GPDMA_ClearIntPending(GPDMA_StateClear_Type type, uint8_t channel)
         LPC_GPDMA->DMACIntErrClr = GPDMA_DMACIntErrClr_Ch(channel);
 }
 
+/*********************************************************************/ /**
+ * @brief		Allocate a free channel. Channels 0 and 1, the highest
+ * 				hardware priorities, are only given to GPDMA_PRIO_HIGH;
+ * 				GPDMA_PRIO_LOW takes the lowest priority channel left.
+ * @param[in]	prioClass	Priority class, should be:
+ * 					- GPDMA_PRIO_HIGH
+ * 					- GPDMA_PRIO_NORMAL
+ * 					- GPDMA_PRIO_LOW
+ * @param[in]	autoFree	TRUE to free the channel by itself once it has
+ * 					been enabled with GPDMA_ChannelCmd() and its transfer has
+ * 					ended: in GPDMA_IntHandler(), after its callbacks, or
+ * 					else in the next GPDMA_ChannelAlloc(); FALSE to keep it
+ * 					until GPDMA_ChannelFree()
+ * @return		Channel number, or GPDMA_CHANNEL_NONE if none is free
+ **********************************************************************/
+uint8_t GPDMA_ChannelAlloc(uint32_t prioClass, Bool autoFree)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint8_t ch, first, last;
+    int8_t step;
+
+    CHECK_PARAM(PARAM_GPDMA_PRIO(prioClass));
+
+    if (prioClass == GPDMA_PRIO_LOW)
+    {
+        first = 7;
+        last = GPDMA_HIGH_CHANNELS;
+        step = -1;
+    }
+    else
+    {
+        first = (prioClass == GPDMA_PRIO_HIGH) ? 0 : GPDMA_HIGH_CHANNELS;
+        last = 7;
+        step = 1;
+    }
+
+    __disable_irq();
+
+    /* Catch the channels that ended with their interrupts masked */
+    gpdma_FreeDone();
+
+    for (ch = first;; ch += step)
+    {
+        if (!(GPDMA_ChAlloc & (1 << ch)))
+        {
+            GPDMA_ChAlloc |= (1 << ch);
+            if (autoFree)
+            {
+                GPDMA_ChAuto |= (1 << ch);
+            }
+            break;
+        }
+        if (ch == last)
+        {
+            ch = GPDMA_CHANNEL_NONE;
+            break;
+        }
+    }
+
+    __set_PRIMASK(primask);
+    return ch;
+}
+
+/*********************************************************************/ /**
+ * @brief		Disable a channel and free it, with its DMAREQSEL claims and
+ * 				callbacks
+ * @param[in]	channelNum	GPDMA channel, should be in range from 0 to 7
+ * @return		None
+ **********************************************************************/
+void GPDMA_ChannelFree(uint8_t channelNum)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    CHECK_PARAM(PARAM_GPDMA_CHANNEL(channelNum));
+
+    __disable_irq();
+    ((LPC_GPDMACH_TypeDef*)pGPDMACh[channelNum])->DMACCConfig &= ~GPDMA_DMACCxConfig_E;
+    gpdma_FreeLocked(channelNum);
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Claim the DMA request of a connection for a channel, and
+ * 				route its DMAREQSEL line. A line is shared by a UART request
+ * 				(connections 8 to 15) and a timer match request (16 to 23);
+ * 				it is counted, and can only be claimed for one of them at a
+ * 				time. The claims are released by GPDMA_ChannelFree() or the
+ * 				next GPDMA_Setup() of the channel.
+ * @param[in]	channelNum	GPDMA channel, should be in range from 0 to 7
+ * @param[in]	conn		Connection, GPDMA_CONN_x
+ * @return		SUCCESS, or ERROR if the line is claimed for the other
+ * 				peripheral
+ **********************************************************************/
+Status GPDMA_ReqSelClaim(uint8_t channelNum, uint32_t conn)
+{
+    uint32_t primask;
+    uint32_t line = conn & 0x07;
+    uint32_t timer = (conn > GPDMA_CONN_UART3_Rx) ? 1 : 0;
+    Status ret = SUCCESS;
+
+    CHECK_PARAM(PARAM_GPDMA_CHANNEL(channelNum));
+    CHECK_PARAM(PARAM_GPDMA_CONN(conn));
+
+    /* Connections 0 to 7 are not muxed */
+    if ((conn < GPDMA_CONN_UART0_Tx) || (GPDMA_ChReq[channelNum] & (1UL << conn)))
+    {
+        return SUCCESS;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (GPDMA_ReqRef[line] == 0)
+    {
+        if (timer)
+        {
+            LPC_SC->DMAREQSEL |= (1UL << line);
+        }
+        else
+        {
+            LPC_SC->DMAREQSEL &= ~(1UL << line);
+        }
+    }
+    if ((GPDMA_ReqRef[line] != 0) && (((LPC_SC->DMAREQSEL >> line) & 1) != timer))
+    {
+        ret = ERROR;
+    }
+    else
+    {
+        GPDMA_ReqRef[line]++;
+        GPDMA_ChReq[channelNum] |= (1UL << conn);
+    }
+    __set_PRIMASK(primask);
+
+    return ret;
+}
+
+/*********************************************************************/ /**
+ * @brief		Set the callbacks of a channel, run by GPDMA_IntHandler()
+ * @param[in]	channelNum	GPDMA channel, should be in range from 0 to 7
+ * @param[in]	tcCallback	Called on a terminal count interrupt, or NULL
+ * @param[in]	errCallback	Called on an error interrupt, or NULL
+ * @param[in]	arg			Passed to the callbacks
+ * @return		None
+ **********************************************************************/
+void GPDMA_SetCallback(uint8_t channelNum, GPDMA_Callback tcCallback, GPDMA_Callback errCallback, void* arg)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    CHECK_PARAM(PARAM_GPDMA_CHANNEL(channelNum));
+
+    __disable_irq();
+    GPDMA_TCCallback[channelNum] = tcCallback;
+    GPDMA_ErrCallback[channelNum] = errCallback;
+    GPDMA_CallbackArg[channelNum] = arg;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		GPDMA interrupt dispatcher, call from DMA_IRQHandler(). Reads
+ * 				and clears the pending flags of all channels at once, then
+ * 				runs the callbacks of the set flags only, errors first, in
+ * 				channel priority order. Auto freed channels that have ended
+ * 				are freed after their callbacks, unless a callback enabled
+ * 				them again.
+ * @param[in]	None
+ * @return		None
+ **********************************************************************/
+void GPDMA_IntHandler(void)
+{
+    uint32_t primask;
+    uint32_t tc = LPC_GPDMA->DMACIntTCStat;
+    uint32_t err = LPC_GPDMA->DMACIntErrStat;
+    uint32_t ch;
+
+    LPC_GPDMA->DMACIntTCClear = tc;
+    LPC_GPDMA->DMACIntErrClr = err;
+
+    while (err)
+    {
+        /* Lowest set bit first, channel 0 has the highest priority */
+        ch = __CLZ(__RBIT(err));
+        err &= ~(1UL << ch);
+        if (GPDMA_ErrCallback[ch])
+        {
+            GPDMA_ErrCallback[ch](ch, GPDMA_CallbackArg[ch]);
+        }
+    }
+    while (tc)
+    {
+        ch = __CLZ(__RBIT(tc));
+        tc &= ~(1UL << ch);
+        if (GPDMA_TCCallback[ch])
+        {
+            GPDMA_TCCallback[ch](ch, GPDMA_CallbackArg[ch]);
+        }
+    }
+
+    if (GPDMA_ChArmed)
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        gpdma_FreeDone();
+        __set_PRIMASK(primask);
+    }
+}
+
 /**
  * @}
  */
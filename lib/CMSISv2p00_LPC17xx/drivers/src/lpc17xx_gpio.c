@@ -55,6 +55,7 @@
 static LPC_GPIO_TypeDef* GPIO_GetPointer(uint8_t portNum);
 static GPIO_HalfWord_TypeDef* FIO_HalfWordGetPointer(uint8_t portNum);
 static GPIO_Byte_TypeDef* FIO_ByteGetPointer(uint8_t portNum);
+static __IO uint32_t* GPIO_GetIntEnReg(uint8_t portNum, uint8_t edgeState);
 
 /*********************************************************************/ /**
                                                                          * @brief		Get pointer to GPIO peripheral due
@@ -65,19 +66,12 @@ static GPIO_Byte_TypeDef* FIO_ByteGetPointer(uint8_t portNum);
                                                                          **********************************************************************/
 static LPC_GPIO_TypeDef* GPIO_GetPointer(uint8_t portNum)
 {
-    LPC_GPIO_TypeDef* pGPIO = NULL;
-
-    switch (portNum)
+    /* Ports are 0x20 apart, no branch on the port number */
+    if (portNum > 4)
     {
-        case 0: pGPIO = LPC_GPIO0; break;
-        case 1: pGPIO = LPC_GPIO1; break;
-        case 2: pGPIO = LPC_GPIO2; break;
-        case 3: pGPIO = LPC_GPIO3; break;
-        case 4: pGPIO = LPC_GPIO4; break;
-        default: break;
+        return NULL;
     }
-
-    return pGPIO;
+    return (LPC_GPIO_TypeDef*)(LPC_GPIO_BASE + ((uint32_t)portNum << 5));
 }
 
 /*********************************************************************/ /**
@@ -89,19 +83,11 @@ static LPC_GPIO_TypeDef* GPIO_GetPointer(uint8_t portNum)
                                                                          **********************************************************************/
 static GPIO_HalfWord_TypeDef* FIO_HalfWordGetPointer(uint8_t portNum)
 {
-    GPIO_HalfWord_TypeDef* pFIO = NULL;
-
-    switch (portNum)
+    if (portNum > 4)
     {
-        case 0: pFIO = GPIO0_HalfWord; break;
-        case 1: pFIO = GPIO1_HalfWord; break;
-        case 2: pFIO = GPIO2_HalfWord; break;
-        case 3: pFIO = GPIO3_HalfWord; break;
-        case 4: pFIO = GPIO4_HalfWord; break;
-        default: break;
+        return NULL;
     }
-
-    return pFIO;
+    return (GPIO_HalfWord_TypeDef*)(LPC_GPIO_BASE + ((uint32_t)portNum << 5));
 }
 
 /*********************************************************************/ /**
@@ -113,19 +99,37 @@ static GPIO_HalfWord_TypeDef* FIO_HalfWordGetPointer(uint8_t portNum)
                                                                          **********************************************************************/
 static GPIO_Byte_TypeDef* FIO_ByteGetPointer(uint8_t portNum)
 {
-    GPIO_Byte_TypeDef* pFIO = NULL;
+    if (portNum > 4)
+    {
+        return NULL;
+    }
+    return (GPIO_Byte_TypeDef*)(LPC_GPIO_BASE + ((uint32_t)portNum << 5));
+}
 
-    switch (portNum)
+/*********************************************************************/ /**
+                                                                         * @brief		Get pointer to the GPIO interrupt
+                                                                         *enable register of a port and edge
+                                                                         * @param[in]	portNum		Port Number value,
+                                                                         *should be 0 or 2.
+                                                                         * @param[in]	edgeState	0: Rising edge, 1:
+                                                                         *Falling edge
+                                                                         * @return		Pointer to IOxIntEnR/F, NULL if the
+                                                                         *port has no GPIO interrupts
+                                                                         **********************************************************************/
+static __IO uint32_t* GPIO_GetIntEnReg(uint8_t portNum, uint8_t edgeState)
+{
+    __IO uint32_t* pIntEn = NULL;
+
+    if (portNum == 0)
+    {
+        pIntEn = (edgeState == 0) ? &LPC_GPIOINT->IO0IntEnR : &LPC_GPIOINT->IO0IntEnF;
+    }
+    else if (portNum == 2)
     {
-        case 0: pFIO = GPIO0_Byte; break;
-        case 1: pFIO = GPIO1_Byte; break;
-        case 2: pFIO = GPIO2_Byte; break;
-        case 3: pFIO = GPIO3_Byte; break;
-        case 4: pFIO = GPIO4_Byte; break;
-        default: break;
+        pIntEn = (edgeState == 0) ? &LPC_GPIOINT->IO2IntEnR : &LPC_GPIOINT->IO2IntEnF;
     }
 
-    return pFIO;
+    return pIntEn;
 }
 
 /* End of Private Functions --------------------------------------------------- */
@@ -258,9 +262,9 @@ uint32_t GPIO_ReadValue(uint8_t portNum)
                                                                          *for P0.0-P0.30, P2.0-P2.13)
                                                                          * @param[in]	portNum		Port number to read
                                                                          *value, should be: 0 or 2
-                                                                         * @param[in]	bitValue	Value that contains all
+                                                                         * @param[in]	bitValue	Value that contains the
                                                                          *bits on GPIO to enable, in range from 0 to
-                                                                         *0xFFFFFFFF.
+                                                                         *0xFFFFFFFF. Other pins keep their setting.
                                                                          * @param[in]	edgeState	state of edge, should
                                                                          *be:
                                                                          * 							- 0: Rising edge
@@ -269,18 +273,36 @@ uint32_t GPIO_ReadValue(uint8_t portNum)
                                                                          **********************************************************************/
 void GPIO_IntCmd(uint8_t portNum, uint32_t bitValue, uint8_t edgeState)
 {
-    if ((portNum == 0) && (edgeState == 0))
-        LPC_GPIOINT->IO0IntEnR = bitValue;
-    else if ((portNum == 2) && (edgeState == 0))
-        LPC_GPIOINT->IO2IntEnR = bitValue;
-    else if ((portNum == 0) && (edgeState == 1))
-        LPC_GPIOINT->IO0IntEnF = bitValue;
-    else if ((portNum == 2) && (edgeState == 1))
-        LPC_GPIOINT->IO2IntEnF = bitValue;
-    else
-        // Error
-        while (1)
-            ;
+    __IO uint32_t* pIntEn = GPIO_GetIntEnReg(portNum, edgeState);
+
+    if (pIntEn != NULL)
+    {
+        *pIntEn |= bitValue;
+    }
+}
+
+/*********************************************************************/ /**
+                                                                         * @brief		Disable GPIO interrupt (just used
+                                                                         *for P0.0-P0.30, P2.0-P2.13)
+                                                                         * @param[in]	portNum		Port number to read
+                                                                         *value, should be: 0 or 2
+                                                                         * @param[in]	bitValue	Value that contains the
+                                                                         *bits on GPIO to disable, in range from 0 to
+                                                                         *0xFFFFFFFF. Other pins keep their setting.
+                                                                         * @param[in]	edgeState	state of edge, should
+                                                                         *be:
+                                                                         * 							- 0: Rising edge
+                                                                         * 							- 1: Falling edge
+                                                                         * @return		None
+                                                                         **********************************************************************/
+void GPIO_IntDisable(uint8_t portNum, uint32_t bitValue, uint8_t edgeState)
+{
+    __IO uint32_t* pIntEn = GPIO_GetIntEnReg(portNum, edgeState);
+
+    if (pIntEn != NULL)
+    {
+        *pIntEn &= ~bitValue;
+    }
 }
 
 /*********************************************************************/ /**
@@ -311,9 +333,8 @@ FunctionalState GPIO_GetIntStatus(uint8_t portNum, uint32_t pinNum, uint8_t edge
     else if ((portNum == 2) && (edgeState == 1))
         return ((FunctionalState)(((LPC_GPIOINT->IO2IntStatF) >> pinNum) & 0x1));
     else
-        // Error
-        while (1)
-            ;
+        // Invalid portNum, no interrupt
+        return DISABLE;
 }
 /*********************************************************************/ /**
                                                                          * @brief		Clear GPIO interrupt (just used for
@@ -331,10 +352,6 @@ void GPIO_ClearInt(uint8_t portNum, uint32_t bitValue)
         LPC_GPIOINT->IO0IntClr = bitValue;
     else if (portNum == 2)
         LPC_GPIOINT->IO2IntClr = bitValue;
-    else
-        // Invalid portNum
-        while (1)
-            ;
 }
 
 /* FIO word accessible ----------------------------------------------------------------- */
@@ -0,0 +1,328 @@
+/**********************************************************************
+ * $Id$		lpc17xx_gpioin.c				2026-10-18
+ *//**
+* @file		lpc17xx_gpioin.c
+* @brief	Contains all functions support for debounced GPIO interrupt
+* 			inputs on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup GPIOIN
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_gpioin.h"
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_ringbuf.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _GPIOIN
+
+/* Private Types -------------------------------------------------------------- */
+/** State of one input pin */
+typedef struct
+{
+    TMRWHEEL_Timer_Type Timer;  /**< Debounce timer */
+    uint32_t Debounce;          /**< Debounce time in ticks */
+    volatile uint32_t EdgeTime; /**< Counter at the first edge of the burst */
+    uint8_t Portnum;
+    uint8_t Pinnum;
+    uint8_t Edges;
+    uint8_t Level;              /**< Debounced level */
+    volatile uint8_t Settling;  /**< Edges seen, debounce timer running */
+    volatile uint8_t Bounces;
+} GPIOIN_Pin_Type;
+
+RINGBUF_DECLARE(GPIOIN_Queue, GPIOIN_Event_Type, GPIOIN_QUEUE_SIZE)
+
+/* Private Variables ---------------------------------------------------------- */
+static GPIOIN_Pin_Type GPIOIN_Pins[GPIOIN_MAX_PINS];
+static uint32_t GPIOIN_NumPins;
+/** Pin index by port (0: port 0, 1: port 2) and pin, 0xFF if not configured */
+static uint8_t GPIOIN_Map[2][32];
+/** Configured pins by port (0: port 0, 1: port 2) */
+static uint32_t GPIOIN_Mask[2];
+static GPIOIN_Queue_Type GPIOIN_Events;
+static uint32_t GPIOIN_Dropped;
+
+/* Private Functions ---------------------------------------------------------- */
+static uint8_t GPIOIN_Find(uint8_t portNum, uint8_t pinNum)
+{
+    if (!PARAM_GPIOIN_PIN(portNum, pinNum))
+    {
+        return 0xFF;
+    }
+    return GPIOIN_Map[portNum >> 1][pinNum];
+}
+
+/** Debounce timer callback, runs from TMRWHEEL_Dispatch() */
+static void GPIOIN_Settled(void* arg)
+{
+    GPIOIN_Pin_Type* p = (GPIOIN_Pin_Type*)arg;
+    GPIOIN_Event_Type event;
+    uint32_t primask = __get_PRIMASK();
+    uint8_t level;
+
+    __disable_irq();
+    if (TMRWHEEL_IsActive(&p->Timer))
+    {
+        /* Another bounce restarted the timer before this dispatch */
+        __set_PRIMASK(primask);
+        return;
+    }
+    p->Settling = 0;
+    event.Timestamp = p->EdgeTime;
+    event.Bounces = p->Bounces;
+    level = (uint8_t)((GPIO_ReadValue(p->Portnum) >> p->Pinnum) & 0x01);
+    __set_PRIMASK(primask);
+
+    if (level == p->Level)
+    {
+        /* Glitch, back to the level already reported */
+        return;
+    }
+    p->Level = level;
+    event.Portnum = p->Portnum;
+    event.Pinnum = p->Pinnum;
+    event.Edge = level ? GPIOIN_EDGE_RISING : GPIOIN_EDGE_FALLING;
+    if (p->Edges & event.Edge)
+    {
+        if (GPIOIN_Queue_Put(&GPIOIN_Events, event) != SUCCESS)
+        {
+            GPIOIN_Dropped++;
+        }
+    }
+}
+
+static void GPIOIN_Edge(GPIOIN_Pin_Type* p, uint32_t now)
+{
+    if (!p->Settling)
+    {
+        p->Settling = 1;
+        p->EdgeTime = now;
+        p->Bounces = 0;
+    }
+    else if (p->Bounces < 0xFF)
+    {
+        p->Bounces++;
+    }
+    TMRWHEEL_Start(&p->Timer, p->Debounce, 0);
+}
+
+static void GPIOIN_HandlePort(uint8_t portNum, uint32_t status, uint32_t now)
+{
+    uint32_t pin;
+    uint8_t index;
+
+    while (status != 0)
+    {
+        pin = 31 - __CLZ(status);
+        status &= ~(1UL << pin);
+        index = GPIOIN_Map[portNum >> 1][pin];
+        GPIOIN_Edge(&GPIOIN_Pins[index], now);
+    }
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup GPIOIN_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the input layer, no pin configured. TMRWHEEL_Init()
+ * 				must be called first, it provides timestamps and debouncing.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void GPIOIN_Init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < 32; i++)
+    {
+        GPIOIN_Map[0][i] = 0xFF;
+        GPIOIN_Map[1][i] = 0xFF;
+    }
+    GPIOIN_Mask[0] = 0;
+    GPIOIN_Mask[1] = 0;
+    GPIOIN_NumPins = 0;
+    GPIOIN_Dropped = 0;
+    GPIOIN_Queue_Init(&GPIOIN_Events);
+}
+
+/*******************************************************************************
+ * @brief		Configure an input pin and enable its interrupts. Only the
+ * 				interrupt enable bits of this pin are changed. The pin is set
+ * 				as input; its function (GPIO) and pin mode are set by the
+ * 				caller with PINSEL.
+ * @param[in]	GPIOINConfigStruct Pointer to a GPIOIN_PIN_CFG_Type structure
+ * @return		SUCCESS, or ERROR if the pin has no GPIO interrupt or all
+ * 				GPIOIN_MAX_PINS pins are in use
+ *******************************************************************************/
+Status GPIOIN_ConfigPin(const GPIOIN_PIN_CFG_Type* GPIOINConfigStruct)
+{
+    uint8_t port = GPIOINConfigStruct->Portnum;
+    uint8_t pin = GPIOINConfigStruct->Pinnum;
+    uint8_t index;
+    GPIOIN_Pin_Type* p;
+
+    if (!PARAM_GPIOIN_PIN(port, pin))
+    {
+        return ERROR;
+    }
+    index = GPIOIN_Find(port, pin);
+    if (index == 0xFF)
+    {
+        if (GPIOIN_NumPins >= GPIOIN_MAX_PINS)
+        {
+            return ERROR;
+        }
+        index = (uint8_t)GPIOIN_NumPins++;
+    }
+    else
+    {
+        GPIOIN_PinCmd(port, pin, DISABLE);
+    }
+
+    p = &GPIOIN_Pins[index];
+    p->Portnum = port;
+    p->Pinnum = pin;
+    p->Edges = GPIOINConfigStruct->Edges;
+    p->Debounce = TMRWHEEL_UsToTicks(GPIOINConfigStruct->DebounceUs);
+    p->Settling = 0;
+    p->Bounces = 0;
+    TMRWHEEL_TimerInit(&p->Timer, GPIOIN_Settled, p);
+
+    GPIO_SetDir(port, 1UL << pin, GPIO_DIR_INPUT);
+    p->Level = (uint8_t)((GPIO_ReadValue(port) >> pin) & 0x01);
+    GPIOIN_Map[port >> 1][pin] = index;
+    GPIOIN_Mask[port >> 1] |= 1UL << pin;
+
+    GPIOIN_PinCmd(port, pin, ENABLE);
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Enable or disable the interrupts of a configured input pin,
+ * 				other pins are not affected
+ * @param[in]	portNum Port number, 0 or 2
+ * @param[in]	pinNum Pin number
+ * @param[in]	NewState ENABLE or DISABLE
+ * @return		None
+ *******************************************************************************/
+void GPIOIN_PinCmd(uint8_t portNum, uint8_t pinNum, FunctionalState NewState)
+{
+    uint8_t index = GPIOIN_Find(portNum, pinNum);
+    uint32_t bit = 1UL << pinNum;
+    GPIOIN_Pin_Type* p;
+
+    if (index == 0xFF)
+    {
+        return;
+    }
+    p = &GPIOIN_Pins[index];
+
+    if (NewState == ENABLE)
+    {
+        /* Both edges are needed to see every bounce, Edges only filters
+         * what is reported */
+        GPIO_ClearInt(portNum, bit);
+        GPIO_IntCmd(portNum, bit, 0);
+        GPIO_IntCmd(portNum, bit, 1);
+    }
+    else
+    {
+        GPIO_IntDisable(portNum, bit, 0);
+        GPIO_IntDisable(portNum, bit, 1);
+        GPIO_ClearInt(portNum, bit);
+        TMRWHEEL_Cancel(&p->Timer);
+        p->Settling = 0;
+    }
+}
+
+/*******************************************************************************
+ * @brief		Get the debounced level of a configured input pin
+ * @param[in]	portNum Port number, 0 or 2
+ * @param[in]	pinNum Pin number
+ * @return		TRUE if high, FALSE if low or not configured
+ *******************************************************************************/
+Bool GPIOIN_GetLevel(uint8_t portNum, uint8_t pinNum)
+{
+    uint8_t index = GPIOIN_Find(portNum, pinNum);
+
+    if (index == 0xFF)
+    {
+        return FALSE;
+    }
+    return GPIOIN_Pins[index].Level ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * @brief		Take the oldest input event
+ * @param[out]	event Pointer to the event to fill in
+ * @return		TRUE if an event was taken, FALSE if the queue is empty
+ *******************************************************************************/
+Bool GPIOIN_GetEvent(GPIOIN_Event_Type* event)
+{
+    return (GPIOIN_Queue_Get(&GPIOIN_Events, event) == SUCCESS) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * @brief		Get the number of events lost to a full queue
+ * @param[in]	None
+ * @return		Number of dropped events
+ *******************************************************************************/
+uint32_t GPIOIN_GetDropped(void)
+{
+    return GPIOIN_Dropped;
+}
+
+/*******************************************************************************
+ * @brief		GPIO interrupt handler, call from EINT3_IRQHandler(). Serves
+ * 				every configured pin of both ports; the flags of other pins
+ * 				are left pending for the caller.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void GPIOIN_IRQHandler(void)
+{
+    uint32_t now = TMRWHEEL_Now();
+    uint32_t status;
+
+    if (LPC_GPIOINT->IntStatus & (1 << 0))
+    {
+        status = (LPC_GPIOINT->IO0IntStatR | LPC_GPIOINT->IO0IntStatF) & GPIOIN_Mask[0];
+        LPC_GPIOINT->IO0IntClr = status;
+        GPIOIN_HandlePort(0, status, now);
+    }
+    if (LPC_GPIOINT->IntStatus & (1 << 2))
+    {
+        status = (LPC_GPIOINT->IO2IntStatR | LPC_GPIOINT->IO2IntStatF) & GPIOIN_Mask[1];
+        LPC_GPIOINT->IO2IntClr = status;
+        GPIOIN_HandlePort(2, status, now);
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* _GPIOIN */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
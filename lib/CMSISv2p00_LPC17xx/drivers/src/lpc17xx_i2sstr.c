@@ -0,0 +1,358 @@
+/**********************************************************************
+ * $Id$		lpc17xx_i2sstr.c				2026-10-18
+ *//**
+* @file		lpc17xx_i2sstr.c
+* @brief	Contains all functions support for I2S audio streaming on
+* 			LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup I2SSTR
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_i2sstr.h"
+#include "lpc17xx_i2s.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _I2SSTR
+
+/* Private Macros ------------------------------------------------------------- */
+/** I2S DMA of each direction: DMA1 requests on GPDMA connection 5, DMA2 on 6 */
+#define I2SSTR_TX_DMA I2S_DMA_1
+#define I2SSTR_RX_DMA I2S_DMA_2
+
+/* Private Types -------------------------------------------------------------- */
+/** A word of int16 samples: the pack and unpack loops move two samples per
+ * access, may_alias keeps the compiler from assuming it cannot touch them */
+typedef uint32_t __attribute__((may_alias)) I2SSTR_Word;
+
+/* Private Functions ---------------------------------------------------------- */
+/*******************************************************************************
+ * @brief		Terminal count callback of a stream, hands the finished half
+ * 				to the stream callback. The channel has already loaded the
+ * 				next item, whose link points back at the half it left: the
+ * 				finished half is read from DMACCLLI, so terminal counts that
+ * 				came together in one interrupt cannot swap the halves.
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Pointer to the stream
+ * @return		None
+ *******************************************************************************/
+static void I2SSTR_Done(uint8_t channelNum, void* arg)
+{
+    I2SSTR_Type* stream = (I2SSTR_Type*)arg;
+    uint32_t half = (stream->Channel->DMACCLLI == (uint32_t)&stream->Lli[1]) ? 1 : 0;
+
+    stream->Half = (uint8_t)(half ^ 1);
+    if (stream->Callback)
+    {
+        stream->Callback(stream->Buffer + half * stream->Words, stream->Words, stream->Arg);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Error callback of a stream
+ * @param[in]	channelNum GPDMA channel
+ * @param[in]	arg Pointer to the stream
+ * @return		None
+ *******************************************************************************/
+static void I2SSTR_Error(uint8_t channelNum, void* arg)
+{
+    ((I2SSTR_Type*)arg)->Errors++;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup I2SSTR_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize a stream: a GPDMA channel of the given priority
+ * 				class, the I2S DMA request depth, the two linked list items,
+ * 				one per half buffer, and the GPDMA callbacks. I2S_Init() and
+ * 				GPDMA_Init() must be called first, and DMA_IRQHandler() must
+ * 				call GPDMA_IntHandler().
+ * @param[in]	stream Pointer to the stream, in AHB SRAM
+ * @param[in]	I2SSTRConfigStruct Pointer to a I2SSTR_CFG_Type structure
+ * @return		SUCCESS, or ERROR if no channel of the class is free
+ *******************************************************************************/
+Status I2SSTR_Init(I2SSTR_Type* stream, const I2SSTR_CFG_Type* I2SSTRConfigStruct)
+{
+    I2S_DMAConf_Type dmaCfg;
+    uint32_t control, i;
+    uint8_t ch;
+
+    CHECK_PARAM(PARAM_I2S_TRX(I2SSTRConfigStruct->Mode));
+    CHECK_PARAM(PARAM_I2SSTR_WORDS(I2SSTRConfigStruct->Words));
+    CHECK_PARAM(PARAM_GPDMA_PRIO(I2SSTRConfigStruct->PrioClass));
+
+    ch = GPDMA_ChannelAlloc(I2SSTRConfigStruct->PrioClass, FALSE);
+    if (ch == GPDMA_CHANNEL_NONE)
+    {
+        return ERROR;
+    }
+
+    stream->Channel = (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ch * 0x20);
+    stream->ChannelNum = ch;
+    stream->Mode = I2SSTRConfigStruct->Mode;
+    stream->Buffer = I2SSTRConfigStruct->Buffer;
+    stream->Words = I2SSTRConfigStruct->Words;
+    stream->Callback = I2SSTRConfigStruct->Callback;
+    stream->Arg = I2SSTRConfigStruct->Arg;
+    stream->Errors = 0;
+    stream->Half = 0;
+
+    control = GPDMA_DMACCxControl_TransferSize(stream->Words) | GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_4) |
+              GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_4) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |
+              GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_I;
+    for (i = 0; i < 2; i++)
+    {
+        if (stream->Mode == I2S_TX_MODE)
+        {
+            stream->Lli[i].SrcAddr = (uint32_t)(stream->Buffer + i * stream->Words);
+            stream->Lli[i].DstAddr = (uint32_t)&LPC_I2S->I2STXFIFO;
+            stream->Lli[i].Control = control | GPDMA_DMACCxControl_SI;
+        }
+        else
+        {
+            stream->Lli[i].SrcAddr = (uint32_t)&LPC_I2S->I2SRXFIFO;
+            stream->Lli[i].DstAddr = (uint32_t)(stream->Buffer + i * stream->Words);
+            stream->Lli[i].Control = control | GPDMA_DMACCxControl_DI;
+        }
+        stream->Lli[i].NextLLI = (uint32_t)&stream->Lli[i ^ 1];
+    }
+
+    if (stream->Mode == I2S_TX_MODE)
+    {
+        dmaCfg.DMAIndex = I2SSTR_TX_DMA;
+        stream->Config = GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_M2P) |
+                         GPDMA_DMACCxConfig_DestPeripheral(GPDMA_CONN_I2S_Channel_0);
+    }
+    else
+    {
+        dmaCfg.DMAIndex = I2SSTR_RX_DMA;
+        stream->Config = GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_P2M) |
+                         GPDMA_DMACCxConfig_SrcPeripheral(GPDMA_CONN_I2S_Channel_1);
+    }
+    stream->Config |= GPDMA_DMACCxConfig_IE | GPDMA_DMACCxConfig_ITC;
+    dmaCfg.depth = I2SSTR_FIFO_DEPTH;
+    I2S_DMAConfig(LPC_I2S, &dmaCfg, stream->Mode);
+
+    GPDMA_SetCallback(stream->ChannelNum, I2SSTR_Done, I2SSTR_Error, stream);
+    NVIC_EnableIRQ(DMA_IRQn);
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		De-initialize a stream: stop it and give its channel back
+ * @param[in]	stream Pointer to the stream
+ * @return		None
+ *******************************************************************************/
+void I2SSTR_DeInit(I2SSTR_Type* stream)
+{
+    I2SSTR_Stop(stream);
+    GPDMA_ChannelFree(stream->ChannelNum);
+}
+
+/*******************************************************************************
+ * @brief		Start a stream from the first half. A transmit stream has both
+ * 				halves filled by the callback first.
+ * @param[in]	stream Pointer to the stream
+ * @return		None
+ *******************************************************************************/
+void I2SSTR_Start(I2SSTR_Type* stream)
+{
+    LPC_GPDMACH_TypeDef* ch = stream->Channel;
+    uint32_t mask = GPDMA_DMACIntTCClear_Ch(stream->ChannelNum);
+
+    if ((stream->Mode == I2S_TX_MODE) && stream->Callback)
+    {
+        stream->Callback(stream->Buffer, stream->Words, stream->Arg);
+        stream->Callback(stream->Buffer + stream->Words, stream->Words, stream->Arg);
+    }
+    stream->Half = 0;
+
+    LPC_GPDMA->DMACIntTCClear = mask;
+    LPC_GPDMA->DMACIntErrClr = mask;
+    ch->DMACCSrcAddr = stream->Lli[0].SrcAddr;
+    ch->DMACCDestAddr = stream->Lli[0].DstAddr;
+    ch->DMACCLLI = stream->Lli[0].NextLLI;
+    ch->DMACCControl = stream->Lli[0].Control;
+    ch->DMACCConfig = stream->Config | GPDMA_DMACCxConfig_E;
+
+    I2S_DMACmd(LPC_I2S, (stream->Mode == I2S_TX_MODE) ? I2SSTR_TX_DMA : I2SSTR_RX_DMA, stream->Mode, ENABLE);
+}
+
+/*******************************************************************************
+ * @brief		Stop a stream. Words in the channel FIFO are dropped.
+ * @param[in]	stream Pointer to the stream
+ * @return		None
+ *******************************************************************************/
+void I2SSTR_Stop(I2SSTR_Type* stream)
+{
+    I2S_DMACmd(LPC_I2S, (stream->Mode == I2S_TX_MODE) ? I2SSTR_TX_DMA : I2SSTR_RX_DMA, stream->Mode, DISABLE);
+    stream->Channel->DMACCConfig &= ~GPDMA_DMACCxConfig_E;
+}
+
+/*******************************************************************************
+ * @brief		Pack interleaved int16 stereo into I2S words. The layouts are
+ * 				the same, so a word aligned source is copied a word per frame.
+ * @param[out]	dst I2S words
+ * @param[in]	src Left, right samples
+ * @param[in]	frames Number of frames
+ * @return		None
+ *******************************************************************************/
+void I2SSTR_PackStereo16(uint32_t* dst, const int16_t* src, uint32_t frames)
+{
+    const I2SSTR_Word* s = (const I2SSTR_Word*)src;
+
+    if ((uint32_t)src & 3)
+    {
+        while (frames--)
+        {
+            *dst++ = (uint16_t)src[0] | ((uint32_t)(uint16_t)src[1] << 16);
+            src += 2;
+        }
+        return;
+    }
+
+    for (; frames >= 4; frames -= 4)
+    {
+        dst[0] = s[0];
+        dst[1] = s[1];
+        dst[2] = s[2];
+        dst[3] = s[3];
+        dst += 4;
+        s += 4;
+    }
+    while (frames--)
+    {
+        *dst++ = *s++;
+    }
+}
+
+/*******************************************************************************
+ * @brief		Pack q15 mono into I2S words, the sample on both channels.
+ * 				Two samples are read with one word access.
+ * @param[out]	dst I2S words
+ * @param[in]	src Samples
+ * @param[in]	frames Number of samples
+ * @return		None
+ *******************************************************************************/
+void I2SSTR_PackMono16(uint32_t* dst, const int16_t* src, uint32_t frames)
+{
+    const I2SSTR_Word* s;
+    uint32_t w;
+
+    if (((uint32_t)src & 3) && frames)
+    {
+        w = (uint16_t)*src++;
+        *dst++ = w | (w << 16);
+        frames--;
+    }
+
+    s = (const I2SSTR_Word*)src;
+    for (; frames >= 2; frames -= 2)
+    {
+        w = *s++;
+        dst[0] = (w & 0xFFFF) | (w << 16);
+        dst[1] = (w >> 16) | (w & 0xFFFF0000);
+        dst += 2;
+    }
+    if (frames)
+    {
+        w = *(const uint16_t*)s;
+        *dst = w | (w << 16);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Unpack I2S words into interleaved int16 stereo
+ * @param[out]	dst Left, right samples
+ * @param[in]	src I2S words
+ * @param[in]	frames Number of frames
+ * @return		None
+ *******************************************************************************/
+void I2SSTR_UnpackStereo16(int16_t* dst, const uint32_t* src, uint32_t frames)
+{
+    I2SSTR_Word* d = (I2SSTR_Word*)dst;
+
+    if ((uint32_t)dst & 3)
+    {
+        while (frames--)
+        {
+            dst[0] = (int16_t)*src;
+            dst[1] = (int16_t)(*src++ >> 16);
+            dst += 2;
+        }
+        return;
+    }
+
+    for (; frames >= 4; frames -= 4)
+    {
+        d[0] = src[0];
+        d[1] = src[1];
+        d[2] = src[2];
+        d[3] = src[3];
+        d += 4;
+        src += 4;
+    }
+    while (frames--)
+    {
+        *d++ = *src++;
+    }
+}
+
+/*******************************************************************************
+ * @brief		Unpack the left channel of I2S words into q15 mono. Two
+ * 				samples are written with one word access.
+ * @param[out]	dst Samples
+ * @param[in]	src I2S words
+ * @param[in]	frames Number of frames
+ * @return		None
+ *******************************************************************************/
+void I2SSTR_UnpackMono16(int16_t* dst, const uint32_t* src, uint32_t frames)
+{
+    I2SSTR_Word* d;
+
+    if (((uint32_t)dst & 3) && frames)
+    {
+        *dst++ = (int16_t)*src++;
+        frames--;
+    }
+
+    d = (I2SSTR_Word*)dst;
+    for (; frames >= 2; frames -= 2)
+    {
+        *d++ = (src[0] & 0xFFFF) | (src[1] << 16);
+        src += 2;
+    }
+    if (frames)
+    {
+        *(int16_t*)d = (int16_t)*src;
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* _I2SSTR */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
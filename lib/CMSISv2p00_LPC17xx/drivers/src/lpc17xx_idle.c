@@ -0,0 +1,319 @@
+/**********************************************************************
+ * $Id$		lpc17xx_idle.c				2026-10-18
+ *//**
+* @file		lpc17xx_idle.c
+* @brief	Contains all functions support for the tickless idle manager
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup IDLE
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_idle.h"
+#include "lpc17xx_tmrwheel.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_rtcts.h"
+#include "system_LPC17xx.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _IDLE
+
+/* Private Variables ---------------------------------------------------------- */
+/** Configuration, in timer wheel ticks */
+static uint32_t IDLE_SleepLatency;
+static uint32_t IDLE_DeepSleepLatency;
+static uint32_t IDLE_DeepSleepMin;
+static uint32_t IDLE_TicksPerSec;
+static Bool (*IDLE_WorkPending)(void);
+
+static uint64_t IDLE_Ticks[IDLE_NUM_STATES];
+static uint32_t IDLE_Entries[IDLE_NUM_STATES];
+static uint32_t IDLE_LastExit;
+
+/** RTCTS alarm ending a Deep-sleep */
+static RTCTS_Alarm_Type IDLE_WakeAlarm;
+
+/* Private Functions ---------------------------------------------------------- */
+static void IDLE_Wake(void* arg)
+{
+}
+
+static Bool IDLE_DeepSleepAllowed(uint32_t ticks)
+{
+    if ((IDLE_DeepSleepMin == 0) || (ticks < IDLE_DeepSleepMin))
+    {
+        return FALSE;
+    }
+    if (!(LPC_SC->PCONP & CLKPWR_PCONP_PCRTC) || !(LPC_RTC->CCR & RTC_CCR_CLKEN))
+    {
+        return FALSE;
+    }
+    /* DMA stops with the clocks, its completion would be lost */
+    if ((LPC_SC->PCONP & CLKPWR_PCONP_PCGPDMA) && (LPC_GPDMA->DMACEnbldChns != 0))
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*********************************************************************
+ * @brief		Get the time until the earliest RTCTS alarm
+ * @param[in]	elapsed Ticks since the last RTC second boundary
+ * @param[in]	syncSecs RTC time at that boundary
+ * @return		Ticks until the alarm, 0xFFFFFFFF if none is due before
+ * 				the longest Deep-sleep
+ **********************************************************************/
+static uint32_t IDLE_AlarmTicks(uint32_t elapsed, uint32_t syncSecs)
+{
+    uint32_t at, secs;
+
+    if (!RTCTS_GetNextAlarm(&at))
+    {
+        return 0xFFFFFFFF;
+    }
+    if (at <= syncSecs)
+    {
+        return 0;
+    }
+    secs = at - syncSecs;
+    if (secs > IDLE_DEEPSLEEP_MAX_SEC + 1)
+    {
+        return 0xFFFFFFFF;
+    }
+    secs *= IDLE_TicksPerSec;
+    return (secs > elapsed) ? (secs - elapsed) : 0;
+}
+
+/*********************************************************************
+ * @brief		Deep-sleep until the RTC alarm before a deadline
+ * @param[in]	now Counter value on entry
+ * @param[in]	ticks Ticks until the deadline, 0xFFFFFFFF if none
+ * @param[in]	syncTc Counter value at the last RTC second boundary
+ * @param[in]	syncSecs RTC time at that boundary
+ * @return		Ticks spent in Deep-sleep, 0 if the deadline is too close
+ * 				to the next RTC second boundaries to sleep at all
+ **********************************************************************/
+static uint32_t IDLE_DeepSleep(uint32_t now, uint32_t ticks, uint32_t syncTc, uint32_t syncSecs)
+{
+    uint32_t span, secs, woke, slept;
+
+    /* Whole RTC seconds from the last boundary to the wake-up time */
+    if (ticks == 0xFFFFFFFF)
+    {
+        secs = IDLE_DEEPSLEEP_MAX_SEC;
+    }
+    else
+    {
+        span = (now - syncTc) + (ticks - IDLE_DeepSleepLatency);
+        secs = span / IDLE_TicksPerSec;
+        if (secs > IDLE_DEEPSLEEP_MAX_SEC)
+        {
+            secs = IDLE_DEEPSLEEP_MAX_SEC;
+        }
+    }
+    if (secs == 0)
+    {
+        return 0;
+    }
+
+    /* No alarm is due before it, the deadline includes them */
+    RTCTS_AlarmStart(&IDLE_WakeAlarm, syncSecs + secs);
+    RTCTS_Suspend();
+
+    CLKPWR_DeepSleep();
+    SystemResume();
+
+    if (LPC_RTC->ILR & RTC_IRL_RTCALF)
+    {
+        /* Alarm: the wake-up time is exact */
+        woke = syncTc + secs * IDLE_TicksPerSec + IDLE_DeepSleepLatency;
+    }
+    else
+    {
+        /* Other wake-up source: only the RTC second is known */
+        secs = RTCTS_GetSeconds() - syncSecs;
+        woke = syncTc + secs * IDLE_TicksPerSec + IDLE_TicksPerSec / 2;
+    }
+    /* The alarm interrupt, still pending, queues the alarms now due */
+    RTCTS_AlarmCancel(&IDLE_WakeAlarm);
+    RTCTS_Resume();
+
+    /* The timer counter stood still, move it to the real time */
+    slept = woke - TMRWHEEL_Now();
+    if ((int32_t)slept < 0)
+    {
+        slept = 0;
+    }
+    TMRWHEEL_Adjust(slept);
+    return woke - now;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup IDLE_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the idle manager. TMRWHEEL_Init() must be called
+ * 				first, its counter is the time base, and RTCTS_Init() too
+ * 				for Deep-sleep.
+ * @param[in]	IDLEConfigStruct Pointer to a IDLE_CFG_Type structure
+ * @return		None
+ *******************************************************************************/
+void IDLE_Init(const IDLE_CFG_Type* IDLEConfigStruct)
+{
+    IDLE_SleepLatency = TMRWHEEL_UsToTicks(IDLEConfigStruct->SleepLatencyUs);
+    IDLE_DeepSleepLatency = TMRWHEEL_UsToTicks(IDLEConfigStruct->DeepSleepLatencyUs);
+    IDLE_DeepSleepMin = TMRWHEEL_UsToTicks(IDLEConfigStruct->DeepSleepMinUs);
+    IDLE_TicksPerSec = TMRWHEEL_UsToTicks(1000000);
+    IDLE_WorkPending = IDLEConfigStruct->WorkPending;
+    if (IDLE_DeepSleepMin < IDLE_DeepSleepLatency)
+    {
+        IDLE_DeepSleepMin = IDLE_DeepSleepLatency;
+    }
+    RTCTS_AlarmInit(&IDLE_WakeAlarm, IDLE_Wake, NULL);
+    IDLE_ResetStats();
+}
+
+/*******************************************************************************
+ * @brief		Idle until the next interrupt, in the deepest state that
+ * 				meets the next timer deadline. Call from the main loop when
+ * 				there is nothing to do.
+ * @param[in]	None
+ * @return		State that was used
+ *******************************************************************************/
+IDLE_STATE_Type IDLE_Enter(void)
+{
+    IDLE_STATE_Type state = IDLE_STATE_RUN;
+    uint32_t primask, now, ticks, alarm, slept, syncTc, syncSecs;
+    Bool timed, synced;
+
+    /* Interrupts stay masked up to the WFI, so one arriving after the
+     * deadline was read still wakes the CPU instead of being missed */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    now = TMRWHEEL_Now();
+    IDLE_Ticks[IDLE_STATE_RUN] += now - IDLE_LastExit;
+    timed = TMRWHEEL_GetNextDeadline(&ticks);
+    if (!timed)
+    {
+        ticks = 0xFFFFFFFF;
+    }
+
+    /* The RTC second in progress is the one RTCTS last synced to */
+    synced = (IDLE_DeepSleepMin != 0) && RTCTS_GetSync(&syncTc, &syncSecs) &&
+             ((now - syncTc) < IDLE_TicksPerSec) && (RTCTS_GetSeconds() == syncSecs);
+    if (synced)
+    {
+        alarm = IDLE_AlarmTicks(now - syncTc, syncSecs);
+        if (alarm < ticks)
+        {
+            ticks = alarm;
+        }
+    }
+    if ((IDLE_WorkPending != NULL) && IDLE_WorkPending())
+    {
+        ticks = 0;
+    }
+
+    if (ticks > IDLE_SleepLatency)
+    {
+        /* Unsynced, Sleep: the RTCTS second interrupt syncs within 1 s */
+        if (synced && IDLE_DeepSleepAllowed(ticks))
+        {
+            slept = IDLE_DeepSleep(now, ticks, syncTc, syncSecs);
+            if (slept != 0)
+            {
+                IDLE_Ticks[IDLE_STATE_DEEPSLEEP] += slept;
+                state = IDLE_STATE_DEEPSLEEP;
+            }
+        }
+
+        /* The timer wakes the CPU early by the Sleep wake-up latency,
+         * or if it is too late for that, the CPU keeps running */
+        if ((state != IDLE_STATE_DEEPSLEEP) && (!timed || TMRWHEEL_WakeEarly(IDLE_SleepLatency)))
+        {
+            CLKPWR_Sleep();
+            state = IDLE_STATE_SLEEP;
+            IDLE_Ticks[IDLE_STATE_SLEEP] += TMRWHEEL_Now() - now;
+        }
+    }
+
+    IDLE_Entries[state]++;
+    IDLE_LastExit = TMRWHEEL_Now();
+    __set_PRIMASK(primask);
+
+    return state;
+}
+
+/*******************************************************************************
+ * @brief		Get the time spent in an idle state
+ * @param[in]	state Idle state, IDLE_STATE_RUN is the time outside IDLE_Enter()
+ * 				and in IDLE_Enter() calls that did not sleep
+ * @return		Residency in microseconds since the last IDLE_ResetStats()
+ *******************************************************************************/
+uint64_t IDLE_GetResidencyUs(IDLE_STATE_Type state)
+{
+    uint64_t ticks;
+
+    CHECK_PARAM(PARAM_IDLE_STATE(state));
+
+    ticks = IDLE_Ticks[state];
+    return (ticks / IDLE_TicksPerSec) * 1000000UL + ((ticks % IDLE_TicksPerSec) * 1000000UL) / IDLE_TicksPerSec;
+}
+
+/*******************************************************************************
+ * @brief		Get the number of times an idle state was used
+ * @param[in]	state Idle state
+ * @return		Number of IDLE_Enter() calls that used the state
+ *******************************************************************************/
+uint32_t IDLE_GetEntryCount(IDLE_STATE_Type state)
+{
+    CHECK_PARAM(PARAM_IDLE_STATE(state));
+
+    return IDLE_Entries[state];
+}
+
+/*******************************************************************************
+ * @brief		Clear the residency statistics
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void IDLE_ResetStats(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < IDLE_NUM_STATES; i++)
+    {
+        IDLE_Ticks[i] = 0;
+        IDLE_Entries[i] = 0;
+    }
+    IDLE_LastExit = TMRWHEEL_Now();
+}
+
+/**
+ * @}
+ */
+
+#endif /* _IDLE */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
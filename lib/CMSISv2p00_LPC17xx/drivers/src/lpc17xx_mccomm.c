@@ -0,0 +1,271 @@
+/**********************************************************************
+ * $Id$		lpc17xx_mccomm.c				2026-10-18
+ *//**
+* @file		lpc17xx_mccomm.c
+* @brief	Contains all functions support for batched MCPWM commutation
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup MCCOMM
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_mccomm.h"
+#include "lpc17xx_mcpwm.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _MCCOMM
+
+/* Private Macros ------------------------------------------------------------- */
+/** Update disable bits of the three channels */
+#define MCCOMM_DISUP_ALL (MCPWM_CON_DISUP(0) | MCPWM_CON_DISUP(1) | MCPWM_CON_DISUP(2))
+
+/* Private Variables ---------------------------------------------------------- */
+static const MCCOMM_STEP_Type* MCCOMM_Table;
+static uint32_t MCCOMM_Length;
+static volatile uint32_t MCCOMM_Index;
+/** Limit interrupts per step, 0 when stepped by the caller */
+static uint32_t MCCOMM_Periods;
+static uint32_t MCCOMM_Count;
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup MCCOMM_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Configure the three MCPWM channels alike: alignment, polarity,
+ * 				dead time and the 3-phase mode. The channels are stopped and
+ * 				their timers cleared. MCPWM_Init() must be called first.
+ * @param[in]	MCCOMMConfigStruct Pointer to a MCCOMM_CFG_Type structure
+ * @return		None
+ *******************************************************************************/
+void MCCOMM_Init(const MCCOMM_CFG_Type* MCCOMMConfigStruct)
+{
+    uint32_t con = 0;
+    uint32_t ch;
+
+    CHECK_PARAM(PARAM_MCCOMM_MODE(MCCOMMConfigStruct->Mode));
+    CHECK_PARAM(PARAM_MCCOMM_DEADTIME(MCCOMMConfigStruct->DeadTime));
+
+    MCCOMM_TableStop();
+
+    for (ch = 0; ch < 3; ch++)
+    {
+        LPC_MCPWM->MCCON_CLR = MCPWM_CON_RUN(ch) | MCPWM_CON_CENTER(ch) | MCPWM_CON_POLAR(ch) |
+                               MCPWM_CON_DTE(ch) | MCPWM_CON_DISUP(ch);
+        if (MCCOMMConfigStruct->Center)
+        {
+            con |= MCPWM_CON_CENTER(ch);
+        }
+        if (MCCOMMConfigStruct->PassiveHigh)
+        {
+            con |= MCPWM_CON_POLAR(ch);
+        }
+        if (MCCOMMConfigStruct->DeadTime)
+        {
+            con |= MCPWM_CON_DTE(ch);
+        }
+    }
+    LPC_MCPWM->MCCON_CLR = MCPWM_CON_ACMODE | MCPWM_CON_DCMODE | MCPWM_CON_INVBDC;
+
+    if (MCCOMMConfigStruct->Mode == MCCOMM_MODE_AC)
+    {
+        con |= MCPWM_CON_ACMODE;
+    }
+    else if (MCCOMMConfigStruct->Mode == MCCOMM_MODE_DC)
+    {
+        con |= MCPWM_CON_DCMODE;
+        if (MCCOMMConfigStruct->InvertB)
+        {
+            con |= MCPWM_CON_INVBDC;
+        }
+    }
+
+    /* The dead time register is not shadowed, only write it while stopped */
+    LPC_MCPWM->MCDEADTIME = MCPWM_DT(0, MCCOMMConfigStruct->DeadTime) | MCPWM_DT(1, MCCOMMConfigStruct->DeadTime) |
+                            MCPWM_DT(2, MCCOMMConfigStruct->DeadTime);
+    LPC_MCPWM->MCTIM0 = 0;
+    LPC_MCPWM->MCTIM1 = 0;
+    LPC_MCPWM->MCTIM2 = 0;
+    LPC_MCPWM->MCCON_SET = con;
+}
+
+/*******************************************************************************
+ * @brief		Write one step to the three channels. The functional registers
+ * 				of all channels load together at the next period boundary; a
+ * 				boundary during the write keeps the previous step.
+ * @param[in]	step Pointer to the step
+ * @return		None
+ *******************************************************************************/
+void MCCOMM_Write(const MCCOMM_STEP_Type* step)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    /* Not preempted by the table interrupt between DISUP set and clear */
+    __disable_irq();
+    LPC_MCPWM->MCCON_SET = MCCOMM_DISUP_ALL;
+    LPC_MCPWM->MCPER0 = step->Limit[0];
+    LPC_MCPWM->MCPER1 = step->Limit[1];
+    LPC_MCPWM->MCPER2 = step->Limit[2];
+    LPC_MCPWM->MCPW0 = step->Match[0];
+    LPC_MCPWM->MCPW1 = step->Match[1];
+    LPC_MCPWM->MCPW2 = step->Match[2];
+    LPC_MCPWM->MCCCP = step->Pattern;
+    LPC_MCPWM->MCCON_CLR = MCCOMM_DISUP_ALL;
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Write the first step of a table and start stepping through it
+ * 				from the channel 0 limit interrupt. Each step is written in the
+ * 				limit interrupt and loads at the following period boundary: in
+ * 				center aligned mode the same period, in edge aligned mode one
+ * 				period later. The table wraps around at its end.
+ * @param[in]	table Steps, must stay valid until MCCOMM_TableStop()
+ * @param[in]	length Number of steps
+ * @param[in]	periodsPerStep Periods per step, 0 for stepping by MCCOMM_Step()
+ * 				only
+ * @return		SUCCESS, or ERROR if length is 0 or a match is above its limit
+ *******************************************************************************/
+Status MCCOMM_TableStart(const MCCOMM_STEP_Type* table, uint32_t length, uint32_t periodsPerStep)
+{
+    uint32_t i, ch;
+
+    if (length == 0)
+    {
+        return ERROR;
+    }
+    for (i = 0; i < length; i++)
+    {
+        for (ch = 0; ch < 3; ch++)
+        {
+            if (table[i].Match[ch] > table[i].Limit[ch])
+            {
+                return ERROR;
+            }
+        }
+    }
+
+    MCCOMM_TableStop();
+    MCCOMM_Table = table;
+    MCCOMM_Length = length;
+    MCCOMM_Index = 0;
+    MCCOMM_Periods = periodsPerStep;
+    MCCOMM_Count = 0;
+    MCCOMM_Write(&table[0]);
+
+    if (periodsPerStep)
+    {
+        LPC_MCPWM->MCINTFLAG_CLR = MCPWM_INT_ILIM(0);
+        LPC_MCPWM->MCINTEN_SET = MCPWM_INT_ILIM(0);
+        NVIC_EnableIRQ(MCPWM_IRQn);
+    }
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Stop stepping through the table. The last step written stays
+ * 				in effect.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void MCCOMM_TableStop(void)
+{
+    LPC_MCPWM->MCINTEN_CLR = MCPWM_INT_ILIM(0);
+    MCCOMM_Periods = 0;
+    MCCOMM_Table = NULL;
+    MCCOMM_Length = 0;
+}
+
+/*******************************************************************************
+ * @brief		Go to a step of the table, e.g. from the hall sensor state in
+ * 				six-step commutation. A periodic table continues from it.
+ * @param[in]	index Step number
+ * @return		SUCCESS, or ERROR if no table is started or index is out of
+ * 				range
+ *******************************************************************************/
+Status MCCOMM_Step(uint32_t index)
+{
+    uint32_t primask;
+
+    if (index >= MCCOMM_Length)
+    {
+        return ERROR;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    MCCOMM_Index = index;
+    MCCOMM_Count = 0;
+    MCCOMM_Write(&MCCOMM_Table[index]);
+    __set_PRIMASK(primask);
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Get the step last written
+ * @param[in]	None
+ * @return		Step number in the table
+ *******************************************************************************/
+uint32_t MCCOMM_GetIndex(void)
+{
+    return MCCOMM_Index;
+}
+
+/*******************************************************************************
+ * @brief		MCPWM interrupt handler, call from MCPWM_IRQHandler(). Writes
+ * 				the next step on every periodsPerStep-th channel 0 limit.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void MCCOMM_IRQHandler(void)
+{
+    uint32_t index;
+
+    if (!(LPC_MCPWM->MCINTFLAG & MCPWM_INT_ILIM(0)))
+    {
+        return;
+    }
+    LPC_MCPWM->MCINTFLAG_CLR = MCPWM_INT_ILIM(0);
+
+    if ((MCCOMM_Periods == 0) || (++MCCOMM_Count < MCCOMM_Periods))
+    {
+        return;
+    }
+    MCCOMM_Count = 0;
+
+    index = MCCOMM_Index + 1;
+    if (index >= MCCOMM_Length)
+    {
+        index = 0;
+    }
+    MCCOMM_Index = index;
+    MCCOMM_Write(&MCCOMM_Table[index]);
+}
+
+/**
+ * @}
+ */
+
+#endif /* _MCCOMM */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -322,6 +322,54 @@ void PINSEL_ConfigPin(PINSEL_CFG_Type* PinCfg)
     set_OpenDrainMode(PinCfg->Portnum, PinCfg->Pinnum, PinCfg->OpenDrain);
 }
 
+/*******************************************************************************
+ * @brief		Configure all pins of a pin map. The map is merged first, so
+ * 				each PINSEL, PINMODE and PINMODE_OD register touched by the map
+ * 				gets a single read-modify-write, instead of three per pin.
+ * @param[in]	PinMap Pointer to the pin map, see PINSEL_PINMAP_DEFINE
+ * @param[in]	NumPins Number of entries in PinMap
+ * @return		None
+ *******************************************************************************/
+void PINSEL_ConfigPinMap(const PINSEL_PINMAP_Type* PinMap, uint32_t NumPins)
+{
+    uint32_t selMask[10] = {0}, selVal[10] = {0};
+    uint32_t modeMask[10] = {0}, modeVal[10] = {0};
+    uint32_t odMask[5] = {0}, odVal[5] = {0};
+    volatile uint32_t* pSel = &LPC_PINCON->PINSEL0;
+    volatile uint32_t* pMode = &LPC_PINCON->PINMODE0;
+    volatile uint32_t* pOd = &LPC_PINCON->PINMODE_OD0;
+    uint32_t i;
+
+    for (i = 0; i < NumPins; i++, PinMap++)
+    {
+        selMask[PinMap->RegIdx] |= (0x03UL << PinMap->Shift);
+        selVal[PinMap->RegIdx] |= ((uint32_t)(PinMap->Funcnum & 0x03) << PinMap->Shift);
+        modeMask[PinMap->RegIdx] |= (0x03UL << PinMap->Shift);
+        modeVal[PinMap->RegIdx] |= ((uint32_t)(PinMap->Pinmode & 0x03) << PinMap->Shift);
+        odMask[PinMap->Portnum] |= (0x01UL << PinMap->Pinnum);
+        if (PinMap->OpenDrain == PINSEL_PINMODE_OPENDRAIN)
+        {
+            odVal[PinMap->Portnum] |= (0x01UL << PinMap->Pinnum);
+        }
+    }
+
+    for (i = 0; i < 10; i++)
+    {
+        if (selMask[i])
+        {
+            pSel[i] = (pSel[i] & ~selMask[i]) | selVal[i];
+            pMode[i] = (pMode[i] & ~modeMask[i]) | modeVal[i];
+        }
+    }
+    for (i = 0; i < 5; i++)
+    {
+        if (odMask[i])
+        {
+            pOd[i] = (pOd[i] & ~odMask[i]) | odVal[i];
+        }
+    }
+}
+
 /**
  * @}
  */
@@ -0,0 +1,213 @@
+/**********************************************************************
+ * $Id$		lpc17xx_qeitrk.c				2026-10-18
+ *//**
+* @file		lpc17xx_qeitrk.c
+* @brief	Contains all functions support for the QEI position/velocity
+* 			tracker on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup QEITRK
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_qeitrk.h"
+#include "lpc17xx_qei.h"
+#include "lpc17xx_clkpwr.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _QEITRK
+
+/* Private Variables ---------------------------------------------------------- */
+/** Estimated position, counts Q16 */
+static int64_t QEITRK_Pos;
+/** Estimated velocity, counts per period Q16 */
+static int32_t QEITRK_Vel;
+/** Measured position, counts, unwrapped */
+static int64_t QEITRK_Meas;
+static uint32_t QEITRK_LastPos;
+/** Counts of the last period, signed */
+static int32_t QEITRK_Raw;
+static uint32_t QEITRK_Alpha;
+static uint32_t QEITRK_Beta;
+/** RPM Q16 for one count per period */
+static uint32_t QEITRK_RpmScale;
+static volatile uint32_t QEITRK_Updates;
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup QEITRK_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the tracker at the current position, and start the
+ * 				velocity timer interrupt. QEI_Init() must be called first, the
+ * 				capture mode (2X/4X) is taken from it. The position counter is
+ * 				set to wrap at 32 bits.
+ * @param[in]	QEITRKConfigStruct Pointer to a QEITRK_CFG_Type structure
+ * @return		None
+ *******************************************************************************/
+void QEITRK_Init(const QEITRK_CFG_Type* QEITRKConfigStruct)
+{
+    uint64_t pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_QEI);
+    uint32_t edges = (LPC_QEI->QEICONF & QEI_CONF_CAPMODE) ? 4 : 2;
+    uint32_t load;
+
+    load = (uint32_t)((pclk * QEITRKConfigStruct->PeriodUs) / 1000000);
+    if (load == 0)
+    {
+        load = 1;
+    }
+    LPC_QEI->QEILOAD = load - 1;
+    QEI_SetMaxPosition(LPC_QEI, 0xFFFFFFFF);
+
+    /* RPM = counts per period * 60 * pclk / (load * PPR * edges), the only
+     * division, done once */
+    QEITRK_RpmScale = (uint32_t)(((pclk * 60) << QEITRK_FRAC_BITS) /
+                                 ((uint64_t)load * QEITRKConfigStruct->PPR * edges));
+    QEITRK_Alpha = QEITRKConfigStruct->Alpha;
+    QEITRK_Beta = QEITRKConfigStruct->Beta;
+
+    NVIC_DisableIRQ(QEI_IRQn);
+    QEITRK_LastPos = LPC_QEI->QEIPOS;
+    QEITRK_Meas = 0;
+    QEITRK_Pos = 0;
+    QEITRK_Vel = 0;
+    QEITRK_Raw = 0;
+    QEITRK_Updates = 0;
+
+    QEI_Reset(LPC_QEI, QEI_RESET_VEL);
+    QEI_IntClear(LPC_QEI, QEI_INTFLAG_TIM_Int);
+    QEI_IntCmd(LPC_QEI, QEI_INTFLAG_TIM_Int, ENABLE);
+    NVIC_EnableIRQ(QEI_IRQn);
+}
+
+/*******************************************************************************
+ * @brief		QEI interrupt handler, call from QEI_IRQHandler(). Runs one
+ * 				filter update per velocity timer overflow.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void QEITRK_IRQHandler(void)
+{
+    uint32_t pos, cap;
+    int32_t delta, residual;
+    int64_t predicted, error;
+
+    if (!(LPC_QEI->QEIINTSTAT & QEI_INTSTAT_TIM_Int))
+    {
+        return;
+    }
+    LPC_QEI->QEICLR = QEI_INTFLAG_TIM_Int;
+
+    pos = LPC_QEI->QEIPOS;
+    cap = LPC_QEI->QEICAP;
+    delta = (int32_t)(pos - QEITRK_LastPos);
+    QEITRK_LastPos = pos;
+    QEITRK_Meas += delta;
+    /* The capture counts edges, the position change gives the direction */
+    QEITRK_Raw = (delta < 0) ? -(int32_t)cap : (int32_t)cap;
+
+    predicted = QEITRK_Pos + QEITRK_Vel;
+    error = QEITRK_Meas * (1 << QEITRK_FRAC_BITS) - predicted;
+    /* Saturate, so the gains are a single 32x32 multiply */
+    if (error > INT32_MAX)
+    {
+        residual = INT32_MAX;
+    }
+    else if (error < INT32_MIN)
+    {
+        residual = INT32_MIN;
+    }
+    else
+    {
+        residual = (int32_t)error;
+    }
+    QEITRK_Pos = predicted + (((int64_t)residual * QEITRK_Alpha) >> QEITRK_FRAC_BITS);
+    QEITRK_Vel += (int32_t)(((int64_t)residual * QEITRK_Beta) >> QEITRK_FRAC_BITS);
+    QEITRK_Updates++;
+}
+
+/*******************************************************************************
+ * @brief		Get the filtered position
+ * @param[in]	None
+ * @return		Counts since QEITRK_Init(), wrapping at 32 bits
+ *******************************************************************************/
+int32_t QEITRK_GetPosition(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    int64_t pos;
+
+    __disable_irq();
+    pos = QEITRK_Pos;
+    __set_PRIMASK(primask);
+
+    return (int32_t)(pos >> QEITRK_FRAC_BITS);
+}
+
+/*******************************************************************************
+ * @brief		Get the filtered velocity
+ * @param[in]	None
+ * @return		Counts per velocity period, Q16
+ *******************************************************************************/
+int32_t QEITRK_GetVelocity(void)
+{
+    return QEITRK_Vel;
+}
+
+/*******************************************************************************
+ * @brief		Get the filtered speed
+ * @param[in]	None
+ * @return		RPM with QEITRK_RPM_FRAC_BITS fraction bits, negative in
+ * 				reverse
+ *******************************************************************************/
+int32_t QEITRK_GetRpm(void)
+{
+    return (int32_t)(((int64_t)QEITRK_Vel * QEITRK_RpmScale) >> (2 * QEITRK_FRAC_BITS - QEITRK_RPM_FRAC_BITS));
+}
+
+/*******************************************************************************
+ * @brief		Get the unfiltered speed of the last velocity period, from
+ * 				the velocity capture; QEI_CalculateRPM() without division
+ * @param[in]	None
+ * @return		RPM with QEITRK_RPM_FRAC_BITS fraction bits, negative in
+ * 				reverse
+ *******************************************************************************/
+int32_t QEITRK_GetRawRpm(void)
+{
+    return (int32_t)(((int64_t)QEITRK_Raw * QEITRK_RpmScale) >> (QEITRK_FRAC_BITS - QEITRK_RPM_FRAC_BITS));
+}
+
+/*******************************************************************************
+ * @brief		Get the number of filter updates
+ * @param[in]	None
+ * @return		Velocity periods since QEITRK_Init()
+ *******************************************************************************/
+uint32_t QEITRK_GetUpdates(void)
+{
+    return QEITRK_Updates;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _QEITRK */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,213 @@
+/**********************************************************************
+ * $Id$		lpc17xx_ramfunc.c				2026-10-18
+ *//**
+* @file		lpc17xx_ramfunc.c
+* @brief	Contains all functions support for RAM-resident code and
+* 			flash accelerator tuning on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup RAMFUNC
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_ramfunc.h"
+#include "lpc17xx_bootprof.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _RAMFUNC
+
+/* Private Variables ---------------------------------------------------------- */
+/** Vector table in local SRAM */
+#if defined(__ICCARM__)
+#pragma data_alignment = RAMFUNC_VECTOR_ALIGN
+static RAMFUNC_Handler RAMFUNC_Vectors[RAMFUNC_VECTORS] @ SECTION_NAME_RAMVECTORS;
+#else
+static __attribute__((section(SECTION_NAME_RAMVECTORS), aligned(RAMFUNC_VECTOR_ALIGN)))
+RAMFUNC_Handler RAMFUNC_Vectors[RAMFUNC_VECTORS];
+#endif
+
+/* Private Functions ---------------------------------------------------------- */
+/*******************************************************************************
+ * @brief		Write FLASHTIM, from RAM; calls nothing in flash
+ * @param[in]	flashtim Access time in CPU clocks minus one, checked
+ * @return		None
+ *******************************************************************************/
+static SECTION_RAMFUNC void RAMFUNC_WriteFlashTiming(uint32_t flashtim)
+{
+    LPC_SC->FLASHCFG =
+        (LPC_SC->FLASHCFG & ~RAMFUNC_FLASHCFG_FLASHTIM_Msk) | (flashtim << RAMFUNC_FLASHCFG_FLASHTIM_Pos);
+    (void)LPC_SC->FLASHCFG;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup RAMFUNC_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Copy the active vector table to local SRAM and point VTOR at
+ * 				the copy
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void RAMFUNC_RelocateVectors(void)
+{
+    const RAMFUNC_Handler* table = (const RAMFUNC_Handler*)SCB->VTOR;
+    uint32_t primask = __get_PRIMASK();
+    uint32_t i;
+
+    if (table == RAMFUNC_Vectors)
+    {
+        return;
+    }
+
+    __disable_irq();
+    for (i = 0; i < RAMFUNC_VECTORS; i++)
+    {
+        RAMFUNC_Vectors[i] = table[i];
+    }
+    __DSB();
+    SCB->VTOR = (uint32_t)RAMFUNC_Vectors;
+    __DSB();
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Install an exception handler in the RAM vector table.
+ * 				RAMFUNC_RelocateVectors() must be called first.
+ * @param[in]	IRQn Interrupt or system exception number
+ * @param[in]	handler Handler
+ * @return		None
+ *******************************************************************************/
+void RAMFUNC_SetHandler(IRQn_Type IRQn, RAMFUNC_Handler handler)
+{
+    RAMFUNC_Vectors[16 + (int32_t)IRQn] = handler;
+    __DSB();
+}
+
+/*******************************************************************************
+ * @brief		Get the flash access time setting
+ * @param[in]	None
+ * @return		FLASHTIM, the access time in CPU clocks minus one
+ *******************************************************************************/
+uint32_t RAMFUNC_GetFlashTiming(void)
+{
+    return (LPC_SC->FLASHCFG & RAMFUNC_FLASHCFG_FLASHTIM_Msk) >> RAMFUNC_FLASHCFG_FLASHTIM_Pos;
+}
+
+/*******************************************************************************
+ * @brief		Set the flash access time. The register write runs from RAM,
+ * 				so no flash fetch overlaps the change.
+ * @param[in]	flashtim Access time in CPU clocks minus one, at least
+ * 				RAMFUNC_MinFlashTiming() of the CPU clock
+ * @return		None
+ *******************************************************************************/
+void RAMFUNC_SetFlashTiming(uint32_t flashtim)
+{
+    /* Checked here, check_failed() is in flash */
+    CHECK_PARAM(PARAM_RAMFUNC_FLASHTIM(flashtim));
+
+    RAMFUNC_WriteFlashTiming(flashtim);
+}
+
+/*******************************************************************************
+ * @brief		Get the smallest flash access time allowed at a CPU clock:
+ * 				one clock more per 20 MHz, 6 clocks above 100 MHz
+ * @param[in]	cclk CPU clock in Hz
+ * @return		FLASHTIM
+ *******************************************************************************/
+uint32_t RAMFUNC_MinFlashTiming(uint32_t cclk)
+{
+    uint32_t flashtim = (cclk == 0) ? 0 : (cclk - 1) / 20000000;
+
+    return (flashtim >= RAMFUNC_FLASHTIM_COUNT) ? RAMFUNC_FLASHTIM_COUNT - 1 : flashtim;
+}
+
+/*******************************************************************************
+ * @brief		Time an interrupt handler with the DWT cycle counter, from
+ * 				pending the interrupt to its return. The interrupt must be
+ * 				enabled and preempt the caller.
+ * @param[in]	IRQn Interrupt
+ * @param[in]	runs Number of runs, at least 1
+ * @return		Fewest cycles of all runs, entry and exit included
+ *******************************************************************************/
+uint32_t RAMFUNC_MeasureIRQ(IRQn_Type IRQn, uint32_t runs)
+{
+    uint32_t best = 0xFFFFFFFF;
+    uint32_t overhead, t0, t;
+
+    CoreDebug->DEMCR |= BOOTPROF_DEMCR_TRCENA;
+    BOOTPROF_DWT_CTRL |= BOOTPROF_DWT_CTRL_CYCCNTENA;
+
+    /* Cost of the two counter reads alone */
+    t0 = BOOTPROF_DWT_CYCCNT;
+    overhead = BOOTPROF_DWT_CYCCNT - t0;
+
+    while (runs--)
+    {
+        t0 = BOOTPROF_DWT_CYCCNT;
+        NVIC_SetPendingIRQ(IRQn);
+        __DSB();
+        __ISB();
+        t = BOOTPROF_DWT_CYCCNT - t0;
+        if (t < best)
+        {
+            best = t;
+        }
+    }
+
+    return (best > overhead) ? best - overhead : 0;
+}
+
+/*******************************************************************************
+ * @brief		Time an interrupt handler at every allowed flash access time,
+ * 				restoring the setting afterwards
+ * @param[in]	IRQn Interrupt, enabled and preempting the caller
+ * @param[in]	runs Number of runs per setting, at least 1
+ * @param[out]	cycles RAMFUNC_FLASHTIM_COUNT results by FLASHTIM, 0 for
+ * 				the settings too fast for SystemCoreClock
+ * @return		None
+ *******************************************************************************/
+void RAMFUNC_SweepFlashTiming(IRQn_Type IRQn, uint32_t runs, uint32_t* cycles)
+{
+    uint32_t saved = RAMFUNC_GetFlashTiming();
+    uint32_t min = RAMFUNC_MinFlashTiming(SystemCoreClock);
+    uint32_t i;
+
+    for (i = 0; i < RAMFUNC_FLASHTIM_COUNT; i++)
+    {
+        if (i < min)
+        {
+            cycles[i] = 0;
+            continue;
+        }
+        RAMFUNC_SetFlashTiming(i);
+        cycles[i] = RAMFUNC_MeasureIRQ(IRQn, runs);
+    }
+    RAMFUNC_SetFlashTiming(saved);
+}
+
+/**
+ * @}
+ */
+
+#endif /* _RAMFUNC */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
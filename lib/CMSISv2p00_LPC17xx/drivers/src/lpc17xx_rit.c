@@ -37,6 +37,7 @@
 /* Includes ------------------------------------------------------------------- */
 #include "lpc17xx_rit.h"
 #include "lpc17xx_clkpwr.h"
+#include "lpc17xx_bitband.h"
 
 /* If this source file built with example, the LPC17xx FW library configuration
  * file in each example directory ("lpc17xx_libcfg.h") must be included,
@@ -127,7 +128,7 @@ void RIT_TimerConfig(LPC_RIT_TypeDef* RITx, uint32_t time_interval)
     /* Set timer enable clear bit to clear timer to 0 whenever
      * counter value equals the contents of RICOMPVAL
      */
-    RITx->RICTRL |= (1 << 1);
+    BITBAND_SET(RITx->RICTRL, RIT_CTRL_ENCLR_POS);
 }
 
 /******************************************************************************/ /*
@@ -148,11 +149,11 @@ void RIT_Cmd(LPC_RIT_TypeDef* RITx, FunctionalState NewState)
     // Enable or Disable Timer
     if (NewState == ENABLE)
     {
-        RITx->RICTRL |= RIT_CTRL_TEN;
+        BITBAND_SET(RITx->RICTRL, RIT_CTRL_TEN_POS);
     }
     else
     {
-        RITx->RICTRL &= ~RIT_CTRL_TEN;
+        BITBAND_CLR(RITx->RICTRL, RIT_CTRL_TEN_POS);
     }
 }
 
@@ -177,11 +178,11 @@ void RIT_TimerDebugCmd(LPC_RIT_TypeDef* RITx, FunctionalState NewState)
     // Timer Enable/Disable on break
     if (NewState == ENABLE)
     {
-        RITx->RICTRL |= RIT_CTRL_ENBR;
+        BITBAND_SET(RITx->RICTRL, RIT_CTRL_ENBR_POS);
     }
     else
     {
-        RITx->RICTRL &= ~RIT_CTRL_ENBR;
+        BITBAND_CLR(RITx->RICTRL, RIT_CTRL_ENBR_POS);
     }
 }
 /******************************************************************************/ /*
@@ -196,12 +197,12 @@ IntStatus RIT_GetIntStatus(LPC_RIT_TypeDef* RITx)
 {
     IntStatus result;
     CHECK_PARAM(PARAM_RITx(RITx));
-    if ((RITx->RICTRL & RIT_CTRL_INTEN) == 1)
+    if (BITBAND_GET(RITx->RICTRL, RIT_CTRL_INTEN_POS))
         result = SET;
     else
         return RESET;
-    // clear interrupt flag
-    RITx->RICTRL |= RIT_CTRL_INTEN;
+    // clear interrupt flag, write-1-to-clear
+    BITBAND_SET(RITx->RICTRL, RIT_CTRL_INTEN_POS);
     return result;
 }
 
@@ -0,0 +1,513 @@
+/**********************************************************************
+ * $Id$		lpc17xx_rtcts.c				2026-10-18
+ *//**
+* @file		lpc17xx_rtcts.c
+* @brief	Contains all functions support for RTC timestamps and alarms
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup RTCTS
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_rtcts.h"
+#include "lpc17xx_tmrwheel.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _RTCTS
+
+/* Private Macros ------------------------------------------------------------- */
+#define RTCTS_SECS_PER_DAY (86400UL)
+/** Days from 0000-03-01 to 1970-01-01 in the proleptic Gregorian calendar */
+#define RTCTS_EPOCH_DAYS (719468UL)
+
+/* Private Variables ---------------------------------------------------------- */
+/** Sorted by time, earliest first */
+static RTCTS_Alarm_Type* RTCTS_Head;
+/** Expired alarms, FIFO */
+static RTCTS_Alarm_Type* RTCTS_ReadyHead;
+static RTCTS_Alarm_Type* RTCTS_ReadyTail;
+
+static uint32_t RTCTS_TicksPerSec;
+/** Microseconds per timer tick, Q32 */
+static uint64_t RTCTS_UsPerTick;
+/** Timer counter and RTC time at the last second boundary */
+static volatile uint32_t RTCTS_SyncTc;
+static volatile uint32_t RTCTS_SyncSecs;
+static volatile Bool RTCTS_Synced;
+static uint64_t RTCTS_Last;
+
+/* Private Functions ---------------------------------------------------------- */
+/** Days since 1970-01-01 of a date, year >= 1970 */
+static uint32_t RTCTS_DaysFromCivil(uint32_t year, uint32_t month, uint32_t day)
+{
+    uint32_t era, yoe, doy, doe;
+
+    /* Years start in March, so the leap day is the last day of a year */
+    year -= (month <= 2) ? 1 : 0;
+    era = year / 400;
+    yoe = year - era * 400;
+    doy = (153 * ((month > 2) ? (month - 3) : (month + 9)) + 2) / 5 + day - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - RTCTS_EPOCH_DAYS;
+}
+
+/** RTC time in seconds since 1970-01-01, from one consistent read of CTIME0/1 */
+static uint32_t RTCTS_ReadSeconds(void)
+{
+    uint32_t ctime0, ctime1;
+
+    do
+    {
+        ctime0 = LPC_RTC->CTIME0;
+        ctime1 = LPC_RTC->CTIME1;
+    } while (ctime0 != LPC_RTC->CTIME0);
+
+    return RTCTS_DaysFromCivil((ctime1 & RTC_CTIME1_YEAR_MASK) >> 16, (ctime1 & RTC_CTIME1_MONTH_MASK) >> 8,
+                               ctime1 & RTC_CTIME1_DOM_MASK) *
+               RTCTS_SECS_PER_DAY +
+           ((ctime0 & RTC_CTIME0_HOURS_MASK) >> 16) * 3600 + ((ctime0 & RTC_CTIME0_MINUTES_MASK) >> 8) * 60 +
+           (ctime0 & RTC_CTIME0_SECONDS_MASK);
+}
+
+/** Append an alarm to the ready queue, interrupts must be masked */
+static void RTCTS_Ready(RTCTS_Alarm_Type* alarm)
+{
+    alarm->State = RTCTS_ALARM_READY;
+    alarm->Next = NULL;
+    if (RTCTS_ReadyTail != NULL)
+    {
+        RTCTS_ReadyTail->Next = alarm;
+    }
+    else
+    {
+        RTCTS_ReadyHead = alarm;
+    }
+    RTCTS_ReadyTail = alarm;
+}
+
+/** Queue the expired alarms and set the RTC alarm to the earliest pending
+ * one, interrupts must be masked */
+static void RTCTS_Program(void)
+{
+    RTCTS_Alarm_Type* alarm;
+    RTC_TIME_Type t;
+    uint32_t now;
+
+    LPC_RTC->AMR = RTC_AMR_BITMASK;
+    while (1)
+    {
+        now = RTCTS_ReadSeconds();
+        while ((RTCTS_Head != NULL) && (RTCTS_Head->Time <= now))
+        {
+            alarm = RTCTS_Head;
+            RTCTS_Head = alarm->Next;
+            RTCTS_Ready(alarm);
+        }
+        if (RTCTS_Head == NULL)
+        {
+            return;
+        }
+
+        RTCTS_FromSeconds(RTCTS_Head->Time, &t);
+        LPC_RTC->ALSEC = t.SEC;
+        LPC_RTC->ALMIN = t.MIN;
+        LPC_RTC->ALHOUR = t.HOUR;
+        LPC_RTC->ALDOM = t.DOM;
+        LPC_RTC->ALMON = t.MONTH;
+        LPC_RTC->ALYEAR = t.YEAR;
+        LPC_RTC->AMR = RTC_AMR_AMRDOW | RTC_AMR_AMRDOY;
+
+        /* The alarm second may have started while the registers were
+         * written, it would then never match */
+        if (RTCTS_Head->Time > RTCTS_ReadSeconds())
+        {
+            return;
+        }
+        LPC_RTC->AMR = RTC_AMR_BITMASK;
+    }
+}
+
+/** Take an alarm out of the pending list or the ready queue, interrupts
+ * must be masked */
+static void RTCTS_Remove(RTCTS_Alarm_Type* alarm)
+{
+    RTCTS_Alarm_Type** link;
+    RTCTS_Alarm_Type* prev = NULL;
+
+    if (alarm->State == RTCTS_ALARM_PENDING)
+    {
+        link = &RTCTS_Head;
+        while (*link != alarm)
+        {
+            link = &(*link)->Next;
+        }
+        *link = alarm->Next;
+    }
+    else if (alarm->State == RTCTS_ALARM_READY)
+    {
+        link = &RTCTS_ReadyHead;
+        while (*link != alarm)
+        {
+            prev = *link;
+            link = &(*link)->Next;
+        }
+        *link = alarm->Next;
+        if (RTCTS_ReadyTail == alarm)
+        {
+            RTCTS_ReadyTail = prev;
+        }
+    }
+    alarm->State = RTCTS_ALARM_IDLE;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup RTCTS_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the timestamp service, no alarm started. The RTC
+ * 				must be running and TMRWHEEL_Init() must be called first.
+ * 				Call again after setting the RTC time, timestamps are then
+ * 				allowed to go back.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void RTCTS_Init(void)
+{
+    RTCTS_TicksPerSec = TMRWHEEL_UsToTicks(1000000);
+    RTCTS_UsPerTick = (1000000ULL << 32) / RTCTS_TicksPerSec;
+    RTCTS_Head = NULL;
+    RTCTS_ReadyHead = NULL;
+    RTCTS_ReadyTail = NULL;
+    RTCTS_Synced = FALSE;
+    RTCTS_Last = 0;
+
+    LPC_RTC->AMR = RTC_AMR_BITMASK;
+    RTC_ClearIntPending(LPC_RTC, RTC_INT_COUNTER_INCREASE);
+    RTC_ClearIntPending(LPC_RTC, RTC_INT_ALARM);
+    RTC_CntIncrIntConfig(LPC_RTC, RTC_TIMETYPE_SECOND, ENABLE);
+    NVIC_EnableIRQ(RTC_IRQn);
+}
+
+/*******************************************************************************
+ * @brief		Get a timestamp, safe from interrupt handlers
+ * @param[in]	None
+ * @return		Microseconds since 1970-01-01 00:00:00 of the RTC time. Until
+ * 				the first second boundary after RTCTS_Init() the microseconds
+ * 				are 0.
+ *******************************************************************************/
+uint64_t RTCTS_Now(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t secs, elapsed, usec = 0;
+    uint64_t stamp;
+
+    __disable_irq();
+    secs = RTCTS_ReadSeconds();
+    elapsed = TMRWHEEL_Now() - RTCTS_SyncTc;
+
+    /* A boundary whose interrupt is still pending reads as a new second
+     * with no sync, 0 us is then the best estimate */
+    if (RTCTS_Synced && (secs == RTCTS_SyncSecs))
+    {
+        usec = (uint32_t)((elapsed * RTCTS_UsPerTick) >> 32);
+        if (usec > 999999)
+        {
+            usec = 999999;
+        }
+    }
+    stamp = (uint64_t)secs * 1000000UL + usec;
+    if (stamp < RTCTS_Last)
+    {
+        stamp = RTCTS_Last;
+    }
+    RTCTS_Last = stamp;
+    __set_PRIMASK(primask);
+
+    return stamp;
+}
+
+/*******************************************************************************
+ * @brief		Get the RTC time in seconds
+ * @param[in]	None
+ * @return		Seconds since 1970-01-01 00:00:00
+ *******************************************************************************/
+uint32_t RTCTS_GetSeconds(void)
+{
+    return RTCTS_ReadSeconds();
+}
+
+/*******************************************************************************
+ * @brief		Get the timer counter at the last RTC second boundary
+ * @param[out]	tc Timer wheel counter value at the boundary
+ * @param[out]	seconds RTC time at the boundary, seconds since 1970-01-01
+ * @return		FALSE if no boundary was seen since RTCTS_Init() or
+ * 				RTCTS_Resume()
+ *******************************************************************************/
+Bool RTCTS_GetSync(uint32_t* tc, uint32_t* seconds)
+{
+    uint32_t primask = __get_PRIMASK();
+    Bool synced;
+
+    __disable_irq();
+    *tc = RTCTS_SyncTc;
+    *seconds = RTCTS_SyncSecs;
+    synced = RTCTS_Synced;
+    __set_PRIMASK(primask);
+
+    return synced;
+}
+
+/*******************************************************************************
+ * @brief		Stop the second boundary interrupt, e.g. for a Deep-sleep
+ * 				that must not be woken up every second. Alarms keep running.
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void RTCTS_Suspend(void)
+{
+    RTC_CntIncrIntConfig(LPC_RTC, RTC_TIMETYPE_SECOND, DISABLE);
+}
+
+/*******************************************************************************
+ * @brief		Restart the second boundary interrupt after RTCTS_Suspend();
+ * 				the microseconds of RTCTS_Now() wait for the next boundary
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void RTCTS_Resume(void)
+{
+    RTCTS_Synced = FALSE;
+    RTC_ClearIntPending(LPC_RTC, RTC_INT_COUNTER_INCREASE);
+    RTC_CntIncrIntConfig(LPC_RTC, RTC_TIMETYPE_SECOND, ENABLE);
+}
+
+/*******************************************************************************
+ * @brief		Convert a date and time to seconds
+ * @param[in]	pFullTime Date and time, year 1970..2105; DOW and DOY unused
+ * @return		Seconds since 1970-01-01 00:00:00
+ *******************************************************************************/
+uint32_t RTCTS_ToSeconds(const RTC_TIME_Type* pFullTime)
+{
+    return RTCTS_DaysFromCivil(pFullTime->YEAR, pFullTime->MONTH, pFullTime->DOM) * RTCTS_SECS_PER_DAY +
+           pFullTime->HOUR * 3600 + pFullTime->MIN * 60 + pFullTime->SEC;
+}
+
+/*******************************************************************************
+ * @brief		Convert seconds to a date and time
+ * @param[in]	seconds Seconds since 1970-01-01 00:00:00
+ * @param[out]	pFullTime Date and time, with day of week and day of year
+ * @return		None
+ *******************************************************************************/
+void RTCTS_FromSeconds(uint32_t seconds, RTC_TIME_Type* pFullTime)
+{
+    uint32_t days = seconds / RTCTS_SECS_PER_DAY;
+    uint32_t rem = seconds % RTCTS_SECS_PER_DAY;
+    uint32_t z, era, doe, yoe, doy, mp;
+
+    pFullTime->HOUR = rem / 3600;
+    pFullTime->MIN = (rem % 3600) / 60;
+    pFullTime->SEC = rem % 60;
+    /* 1970-01-01 was a Thursday */
+    pFullTime->DOW = (days + 4) % 7;
+
+    z = days + RTCTS_EPOCH_DAYS;
+    era = z / 146097;
+    doe = z - era * 146097;
+    yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    mp = (5 * doy + 2) / 153;
+    pFullTime->DOM = doy - (153 * mp + 2) / 5 + 1;
+    pFullTime->MONTH = (mp < 10) ? (mp + 3) : (mp - 9);
+    pFullTime->YEAR = yoe + era * 400 + ((pFullTime->MONTH <= 2) ? 1 : 0);
+    pFullTime->DOY = days - RTCTS_DaysFromCivil(pFullTime->YEAR, 1, 1) + 1;
+}
+
+/*******************************************************************************
+ * @brief		Initialize an alarm, not started
+ * @param[in]	alarm Pointer to the alarm
+ * @param[in]	callback Function run by RTCTS_Dispatch() when the alarm expires
+ * @param[in]	arg Argument of the callback
+ * @return		None
+ *******************************************************************************/
+void RTCTS_AlarmInit(RTCTS_Alarm_Type* alarm, RTCTS_Callback callback, void* arg)
+{
+    alarm->Next = NULL;
+    alarm->Callback = callback;
+    alarm->Arg = arg;
+    alarm->State = RTCTS_ALARM_IDLE;
+}
+
+/*******************************************************************************
+ * @brief		Start or restart an alarm, safe from callbacks and interrupt
+ * 				handlers. Alarms due at the same second expire in start order.
+ * @param[in]	alarm Pointer to the alarm
+ * @param[in]	seconds Expiry time, seconds since 1970-01-01; a time that has
+ * 				passed expires at once
+ * @return		None
+ *******************************************************************************/
+void RTCTS_AlarmStart(RTCTS_Alarm_Type* alarm, uint32_t seconds)
+{
+    uint32_t primask = __get_PRIMASK();
+    RTCTS_Alarm_Type** link;
+
+    __disable_irq();
+    RTCTS_Remove(alarm);
+    alarm->Time = seconds;
+    link = &RTCTS_Head;
+    while ((*link != NULL) && ((*link)->Time <= seconds))
+    {
+        link = &(*link)->Next;
+    }
+    alarm->Next = *link;
+    *link = alarm;
+    alarm->State = RTCTS_ALARM_PENDING;
+    if (RTCTS_Head == alarm)
+    {
+        RTCTS_Program();
+    }
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Cancel an alarm, also when expired but not yet dispatched
+ * @param[in]	alarm Pointer to the alarm
+ * @return		None
+ *******************************************************************************/
+void RTCTS_AlarmCancel(RTCTS_Alarm_Type* alarm)
+{
+    uint32_t primask = __get_PRIMASK();
+    Bool first;
+
+    __disable_irq();
+    first = (RTCTS_Head == alarm) ? TRUE : FALSE;
+    RTCTS_Remove(alarm);
+    if (first)
+    {
+        RTCTS_Program();
+    }
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Check whether an alarm is started or waiting for dispatch
+ * @param[in]	alarm Pointer to the alarm
+ * @return		TRUE if its callback is still to run
+ *******************************************************************************/
+Bool RTCTS_AlarmIsActive(const RTCTS_Alarm_Type* alarm)
+{
+    return (alarm->State != RTCTS_ALARM_IDLE) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * @brief		Get the time of the earliest started alarm, the one the RTC
+ * 				alarm registers hold
+ * @param[out]	seconds Expiry time, seconds since 1970-01-01
+ * @return		FALSE if no alarm is started
+ *******************************************************************************/
+Bool RTCTS_GetNextAlarm(uint32_t* seconds)
+{
+    uint32_t primask = __get_PRIMASK();
+    Bool started = FALSE;
+
+    __disable_irq();
+    if (RTCTS_Head != NULL)
+    {
+        *seconds = RTCTS_Head->Time;
+        started = TRUE;
+    }
+    __set_PRIMASK(primask);
+
+    return started;
+}
+
+/*******************************************************************************
+ * @brief		RTC interrupt handler, call from RTC_IRQHandler()
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void RTCTS_IRQHandler(void)
+{
+    uint32_t primask;
+
+    if (RTC_GetIntPending(LPC_RTC, RTC_INT_COUNTER_INCREASE))
+    {
+        /* Readers take the synchronisation point as a whole */
+        primask = __get_PRIMASK();
+        __disable_irq();
+        RTCTS_SyncTc = TMRWHEEL_Now();
+        RTCTS_SyncSecs = RTCTS_ReadSeconds();
+        RTCTS_Synced = TRUE;
+        __set_PRIMASK(primask);
+        RTC_ClearIntPending(LPC_RTC, RTC_INT_COUNTER_INCREASE);
+    }
+    if (RTC_GetIntPending(LPC_RTC, RTC_INT_ALARM))
+    {
+        RTC_ClearIntPending(LPC_RTC, RTC_INT_ALARM);
+        primask = __get_PRIMASK();
+        __disable_irq();
+        RTCTS_Program();
+        __set_PRIMASK(primask);
+    }
+}
+
+/*******************************************************************************
+ * @brief		Run the callbacks of expired alarms
+ * @param[in]	None
+ * @return		Number of callbacks run
+ *******************************************************************************/
+uint32_t RTCTS_Dispatch(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    RTCTS_Alarm_Type* alarm;
+    uint32_t count = 0;
+
+    while (1)
+    {
+        __disable_irq();
+        alarm = RTCTS_ReadyHead;
+        if (alarm == NULL)
+        {
+            __set_PRIMASK(primask);
+            break;
+        }
+        RTCTS_ReadyHead = alarm->Next;
+        if (RTCTS_ReadyHead == NULL)
+        {
+            RTCTS_ReadyTail = NULL;
+        }
+        alarm->State = RTCTS_ALARM_IDLE;
+        __set_PRIMASK(primask);
+
+        alarm->Callback(alarm->Arg);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _RTCTS */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
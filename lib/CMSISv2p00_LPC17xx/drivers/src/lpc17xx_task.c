@@ -0,0 +1,246 @@
+/**********************************************************************
+ * $Id$		lpc17xx_task.c				2026-10-18
+ *//**
+* @file		lpc17xx_task.c
+* @brief	Contains all functions support for the cooperative task
+* 			runtime on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup TASK
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_task.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _TASK
+
+/* Private Variables ---------------------------------------------------------- */
+/** Ready queue, FIFO */
+static TASK_Type* TASK_ReadyHead;
+static TASK_Type* TASK_ReadyTail;
+
+/* Private Functions ---------------------------------------------------------- */
+/** Append a task to the ready queue, interrupts must be masked */
+static void TASK_Enqueue(TASK_Type* task)
+{
+    if (task->Queued || task->Done)
+    {
+        return;
+    }
+    task->Queued = 1;
+    task->Next = NULL;
+    if (TASK_ReadyTail != NULL)
+    {
+        TASK_ReadyTail->Next = task;
+    }
+    else
+    {
+        TASK_ReadyHead = task;
+    }
+    TASK_ReadyTail = task;
+}
+
+/** Timer wheel callback of TASK_SLEEP() */
+static void TASK_TimerCallback(void* arg)
+{
+    TASK_Wake((TASK_Type*)arg);
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup TASK_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Start a task, it first runs on the next TASK_Run(). Must not
+ * 				be called again for a task that has not finished.
+ * @param[in]	task Pointer to the task control block
+ * @param[in]	func Task function
+ * @param[in]	arg Task argument, available as task->Arg
+ * @return		None
+ *******************************************************************************/
+void TASK_Start(TASK_Type* task, TASK_Func func, void* arg)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    task->Func = func;
+    task->Arg = arg;
+    task->Lc = 0;
+    task->Queued = 0;
+    task->Done = 0;
+    TMRWHEEL_TimerInit(&task->Timer, TASK_TimerCallback, task);
+
+    __disable_irq();
+    TASK_Enqueue(task);
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Make a waiting task ready, safe from interrupt handlers
+ * @param[in]	task Pointer to the task
+ * @return		None
+ *******************************************************************************/
+void TASK_Wake(TASK_Type* task)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    TASK_Enqueue(task);
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Signal an event and wake its waiting task, safe from interrupt
+ * 				handlers. Signals with no task waiting are counted.
+ * @param[in]	event Pointer to the event
+ * @return		None
+ *******************************************************************************/
+void TASK_EventSignal(TASK_Event_Type* event)
+{
+    uint32_t primask = __get_PRIMASK();
+    TASK_Type* waiter;
+
+    __disable_irq();
+    if (event->Count < 0xFF)
+    {
+        event->Count++;
+    }
+    waiter = event->Waiter;
+    event->Waiter = NULL;
+    if (waiter != NULL)
+    {
+        TASK_Enqueue(waiter);
+    }
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Take one signal of an event, or register the task as its
+ * 				waiter if none is pending. Used by TASK_AWAIT_EVENT(). An
+ * 				event has a single waiter, another task must not be waiting
+ * 				for it already: it would never be woken.
+ * @param[in]	event Pointer to the event
+ * @param[in]	task Pointer to the calling task
+ * @return		TRUE if a signal was taken
+ *******************************************************************************/
+Bool TASK_EventTake(TASK_Event_Type* event, TASK_Type* task)
+{
+    uint32_t primask = __get_PRIMASK();
+    Bool taken = FALSE;
+
+    __disable_irq();
+    if (event->Count != 0)
+    {
+        event->Count--;
+        taken = TRUE;
+    }
+    else
+    {
+        CHECK_PARAM((event->Waiter == NULL) || (event->Waiter == task));
+        event->Waiter = task;
+    }
+    __set_PRIMASK(primask);
+
+    return taken;
+}
+
+/*******************************************************************************
+ * @brief		Get the ticks from now until a timer wheel counter value
+ * @param[in]	deadline Counter value
+ * @return		Ticks until deadline, 0 if it has passed
+ *******************************************************************************/
+uint32_t TASK_TicksUntil(uint32_t deadline)
+{
+    int32_t left = (int32_t)(deadline - TMRWHEEL_Now());
+
+    return (left > 0) ? (uint32_t)left : 0;
+}
+
+/*******************************************************************************
+ * @brief		Dispatch expired timers, then run every task that is ready
+ * 				once. Tasks that yield run again on the next call.
+ * @param[in]	None
+ * @return		Number of task runs, 0 if no task was ready
+ *******************************************************************************/
+uint32_t TASK_Run(void)
+{
+    TASK_Type* task;
+    TASK_Type* last;
+    TASK_RESULT_Type result;
+    uint32_t primask, count = 0;
+
+    TMRWHEEL_Dispatch();
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    last = TASK_ReadyTail;
+    __set_PRIMASK(primask);
+
+    while (last != NULL)
+    {
+        __disable_irq();
+        task = TASK_ReadyHead;
+        TASK_ReadyHead = task->Next;
+        if (TASK_ReadyHead == NULL)
+        {
+            TASK_ReadyTail = NULL;
+        }
+        task->Queued = 0;
+        __set_PRIMASK(primask);
+
+        result = task->Func(task);
+        count++;
+        if (result == TASK_YIELDED)
+        {
+            TASK_Wake(task);
+        }
+        else if (result == TASK_DONE)
+        {
+            task->Done = 1;
+            TMRWHEEL_Cancel(&task->Timer);
+        }
+
+        if (task == last)
+        {
+            break;
+        }
+    }
+    return count;
+}
+
+/*******************************************************************************
+ * @brief		Check for ready tasks, for the idle manager to call with
+ * 				interrupts masked before it sleeps (IDLE_CFG_Type WorkPending)
+ * @param[in]	None
+ * @return		TRUE if a task is ready
+ *******************************************************************************/
+Bool TASK_IsReady(void)
+{
+    return (TASK_ReadyHead != NULL) ? TRUE : FALSE;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _TASK */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
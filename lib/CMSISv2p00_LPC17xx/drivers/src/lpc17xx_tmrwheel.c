@@ -0,0 +1,625 @@
+/**********************************************************************
+ * $Id$		lpc17xx_tmrwheel.c				2026-10-18
+ *//**
+* @file		lpc17xx_tmrwheel.c
+* @brief	Contains all functions support for the software timer wheel
+* 			on LPC17xx
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup TMRWHEEL
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_tmrwheel.h"
+#include "lpc17xx_timer.h"
+#include "lpc17xx_clkpwr.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _TMRWHEEL
+
+/* Private Variables ---------------------------------------------------------- */
+static LPC_TIM_TypeDef* TMRWHEEL_TIMx;
+static volatile uint32_t* TMRWHEEL_MR;
+static uint8_t TMRWHEEL_Channel;
+static uint32_t TMRWHEEL_TickHz;
+
+/** Slot lists and their occupancy bitmaps, one bit per slot */
+static TMRWHEEL_Timer_Type* TMRWHEEL_Slots[TMRWHEEL_LEVELS][TMRWHEEL_SLOTS];
+static uint32_t TMRWHEEL_Occupied[TMRWHEEL_LEVELS];
+
+/** Wheel index processed last. Cascades at this index are done; the level 0
+ * slot of this index may still hold timers due later within the slot. */
+static uint32_t TMRWHEEL_Clock;
+
+/** Expired timers waiting for TMRWHEEL_Dispatch() */
+static TMRWHEEL_Timer_Type* TMRWHEEL_ReadyHead;
+static TMRWHEEL_Timer_Type* TMRWHEEL_ReadyTail;
+
+/* Private Functions ---------------------------------------------------------- */
+static uint32_t TMRWHEEL_Ror(uint32_t value, uint32_t shift)
+{
+    return (value >> shift) | (value << ((32 - shift) & 31));
+}
+
+/** Index of the lowest set bit, value must not be 0 */
+static uint32_t TMRWHEEL_Ctz(uint32_t value)
+{
+    return __CLZ(__RBIT(value));
+}
+
+static void TMRWHEEL_Link(TMRWHEEL_Timer_Type* timer)
+{
+    uint32_t index = timer->Expires >> TMRWHEEL_GRAN_BITS;
+    uint32_t delta = (index - TMRWHEEL_Clock) & TMRWHEEL_INDEX_MASK;
+    uint32_t level = 0;
+    TMRWHEEL_Timer_Type** head;
+
+    /* Already due: the current level 0 slot is checked first */
+    if ((int32_t)(timer->Expires - (TMRWHEEL_Clock << TMRWHEEL_GRAN_BITS)) < 0)
+    {
+        index = TMRWHEEL_Clock;
+        delta = 0;
+    }
+    if (delta != 0)
+    {
+        level = (31 - __CLZ(delta)) / TMRWHEEL_SLOT_BITS;
+    }
+
+    timer->Level = (uint8_t)level;
+    timer->Slot = (uint8_t)((index >> (level * TMRWHEEL_SLOT_BITS)) & (TMRWHEEL_SLOTS - 1));
+    head = &TMRWHEEL_Slots[level][timer->Slot];
+    timer->Prev = NULL;
+    timer->Next = *head;
+    if (*head != NULL)
+    {
+        (*head)->Prev = timer;
+    }
+    *head = timer;
+    TMRWHEEL_Occupied[level] |= (1UL << timer->Slot);
+}
+
+static void TMRWHEEL_Unlink(TMRWHEEL_Timer_Type* timer)
+{
+    TMRWHEEL_Timer_Type** head = &TMRWHEEL_Slots[timer->Level][timer->Slot];
+
+    if (timer->Prev != NULL)
+    {
+        timer->Prev->Next = timer->Next;
+    }
+    else
+    {
+        *head = timer->Next;
+    }
+    if (timer->Next != NULL)
+    {
+        timer->Next->Prev = timer->Prev;
+    }
+    if (*head == NULL)
+    {
+        TMRWHEEL_Occupied[timer->Level] &= ~(1UL << timer->Slot);
+    }
+    timer->Level = 0xFF;
+}
+
+/** Queue an expired timer for dispatch and re-arm it if periodic */
+static void TMRWHEEL_Expire(TMRWHEEL_Timer_Type* timer, uint32_t now)
+{
+    uint32_t missed;
+
+    TMRWHEEL_Unlink(timer);
+    if (timer->Pending < 0xFF)
+    {
+        timer->Pending++;
+    }
+    if (!timer->Queued)
+    {
+        timer->Queued = 1;
+        timer->ReadyNext = NULL;
+        if (TMRWHEEL_ReadyTail != NULL)
+        {
+            TMRWHEEL_ReadyTail->ReadyNext = timer;
+        }
+        else
+        {
+            TMRWHEEL_ReadyHead = timer;
+        }
+        TMRWHEEL_ReadyTail = timer;
+    }
+
+    if (timer->Period != 0)
+    {
+        /* Next expiry from the previous one, so periodic timers do not drift;
+         * expiries already missed are skipped and counted */
+        timer->Expires += timer->Period;
+        if ((int32_t)(timer->Expires - now) <= 0)
+        {
+            missed = (now - timer->Expires) / timer->Period + 1;
+            timer->Expires += missed * timer->Period;
+            timer->Pending = (timer->Pending + missed > 0xFF) ? 0xFF : (uint8_t)(timer->Pending + missed);
+        }
+        TMRWHEEL_Link(timer);
+    }
+}
+
+/** Expire the due timers of the level 0 slot of the current index */
+static void TMRWHEEL_ExpireSlot(uint32_t now)
+{
+    TMRWHEEL_Timer_Type* timer = TMRWHEEL_Slots[0][TMRWHEEL_Clock & (TMRWHEEL_SLOTS - 1)];
+    TMRWHEEL_Timer_Type* next;
+
+    /* Re-armed timers are linked at the head, so they are not visited again */
+    while (timer != NULL)
+    {
+        next = timer->Next;
+        if ((int32_t)(timer->Expires - now) <= 0)
+        {
+            TMRWHEEL_Expire(timer, now);
+        }
+        timer = next;
+    }
+}
+
+/** Move the timers of every level whose period starts at the current index
+ * down the wheel, highest level first */
+static void TMRWHEEL_Cascade(void)
+{
+    TMRWHEEL_Timer_Type* timer;
+    TMRWHEEL_Timer_Type* next;
+    uint32_t level, slot;
+
+    for (level = TMRWHEEL_LEVELS - 1; level > 0; level--)
+    {
+        if (TMRWHEEL_Clock & ((1UL << (level * TMRWHEEL_SLOT_BITS)) - 1))
+        {
+            continue;
+        }
+        slot = (TMRWHEEL_Clock >> (level * TMRWHEEL_SLOT_BITS)) & (TMRWHEEL_SLOTS - 1);
+        timer = TMRWHEEL_Slots[level][slot];
+        TMRWHEEL_Slots[level][slot] = NULL;
+        TMRWHEEL_Occupied[level] &= ~(1UL << slot);
+        while (timer != NULL)
+        {
+            next = timer->Next;
+            TMRWHEEL_Link(timer);
+            timer = next;
+        }
+    }
+}
+
+/*********************************************************************
+ * @brief		Find the next wheel index with work after the current one
+ * @param[out]	level Level holding that work
+ * @return		Distance in wheel indexes, 0 if the wheel is empty
+ **********************************************************************/
+static uint32_t TMRWHEEL_NextEvent(uint32_t* level)
+{
+    uint32_t l, shift, base, rot, d, dist, best = 0;
+
+    for (l = 0; l < TMRWHEEL_LEVELS; l++)
+    {
+        if (TMRWHEEL_Occupied[l] == 0)
+        {
+            continue;
+        }
+        shift = l * TMRWHEEL_SLOT_BITS;
+        base = TMRWHEEL_Clock >> shift;
+        /* Bit d of rot is the slot d periods ahead; the current slot (bit 0)
+         * is done already, at this level it is only reached again a full
+         * turn later */
+        rot = TMRWHEEL_Ror(TMRWHEEL_Occupied[l], base & (TMRWHEEL_SLOTS - 1)) & ~1UL;
+        d = (rot != 0) ? TMRWHEEL_Ctz(rot) : TMRWHEEL_SLOTS;
+        dist = ((base + d) << shift) - TMRWHEEL_Clock;
+        /* On a tie the cascade wins, it may bring an earlier deadline */
+        if ((best == 0) || (dist <= best))
+        {
+            best = dist;
+            *level = l;
+        }
+    }
+    return best;
+}
+
+/** Earliest expiry of a level 0 slot, relative to now */
+static uint32_t TMRWHEEL_SlotMin(uint32_t slot, uint32_t now)
+{
+    TMRWHEEL_Timer_Type* timer = TMRWHEEL_Slots[0][slot];
+    uint32_t min = timer->Expires;
+
+    for (timer = timer->Next; timer != NULL; timer = timer->Next)
+    {
+        if ((timer->Expires - now) < (min - now))
+        {
+            min = timer->Expires;
+        }
+    }
+    return min;
+}
+
+/** Process the wheel up to the counter value now */
+static void TMRWHEEL_Advance(uint32_t now)
+{
+    uint32_t target = now >> TMRWHEEL_GRAN_BITS;
+    uint32_t dist, level;
+
+    for (;;)
+    {
+        TMRWHEEL_ExpireSlot(now);
+        if (TMRWHEEL_Clock == target)
+        {
+            break;
+        }
+        dist = TMRWHEEL_NextEvent(&level);
+        if ((dist == 0) || (dist > ((target - TMRWHEEL_Clock) & TMRWHEEL_INDEX_MASK)))
+        {
+            TMRWHEEL_Clock = target;
+            break;
+        }
+        TMRWHEEL_Clock = (TMRWHEEL_Clock + dist) & TMRWHEEL_INDEX_MASK;
+        TMRWHEEL_Cascade();
+    }
+}
+
+/*********************************************************************
+ * @brief		Program the match register with the next deadline
+ * @param[in]	now Counter value the wheel was advanced to
+ * @return		TRUE if that deadline has passed already
+ **********************************************************************/
+static Bool TMRWHEEL_Program(uint32_t now)
+{
+    uint32_t slot = TMRWHEEL_Clock & (TMRWHEEL_SLOTS - 1);
+    uint32_t match, dist, level;
+
+    if (TMRWHEEL_Occupied[0] & (1UL << slot))
+    {
+        match = TMRWHEEL_SlotMin(slot, now);
+    }
+    else
+    {
+        dist = TMRWHEEL_NextEvent(&level);
+        if (dist == 0)
+        {
+            TMRWHEEL_TIMx->MCR &= ~TIM_INT_ON_MATCH(TMRWHEEL_Channel);
+            return FALSE;
+        }
+        slot = (TMRWHEEL_Clock + dist) & TMRWHEEL_INDEX_MASK;
+        match = slot << TMRWHEEL_GRAN_BITS;
+        if (level == 0)
+        {
+            match = TMRWHEEL_SlotMin(slot & (TMRWHEEL_SLOTS - 1), now);
+        }
+    }
+
+    *TMRWHEEL_MR = match;
+    TMRWHEEL_TIMx->MCR |= TIM_INT_ON_MATCH(TMRWHEEL_Channel);
+    /* The match interrupt only fires when the counter equals the match value */
+    return ((int32_t)(match - TMRWHEEL_TIMx->TC) <= 0) ? TRUE : FALSE;
+}
+
+static void TMRWHEEL_Service(void)
+{
+    uint32_t now;
+
+    do
+    {
+        now = TMRWHEEL_TIMx->TC;
+        TMRWHEEL_Advance(now);
+    } while (TMRWHEEL_Program(now));
+}
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup TMRWHEEL_Public_Functions
+ * @{
+ */
+
+/*******************************************************************************
+ * @brief		Initialize the timer wheel and start its hardware timer. The
+ * 				timer interrupt must be enabled in the NVIC by the caller.
+ * @param[in]	TMRWHEELConfigStruct Pointer to a TMRWHEEL_CFG_Type structure
+ * @return		None
+ *******************************************************************************/
+void TMRWHEEL_Init(const TMRWHEEL_CFG_Type* TMRWHEELConfigStruct)
+{
+    TIM_TIMERCFG_Type timerCfg;
+    uint32_t pclk, l, s;
+
+    CHECK_PARAM(PARAM_TIMx(TMRWHEELConfigStruct->TIMx));
+    CHECK_PARAM(PARAM_TMRWHEEL_MATCH_CHANNEL(TMRWHEELConfigStruct->MatchChannel));
+
+    TMRWHEEL_TIMx = TMRWHEELConfigStruct->TIMx;
+    TMRWHEEL_Channel = TMRWHEELConfigStruct->MatchChannel;
+    TMRWHEEL_MR = &TMRWHEEL_TIMx->MR0 + TMRWHEEL_Channel;
+
+    timerCfg.PrescaleOption = TIM_PRESCALE_TICKVAL;
+    timerCfg.PrescaleValue = (TMRWHEELConfigStruct->PrescaleValue != 0) ? TMRWHEELConfigStruct->PrescaleValue : 1;
+    TIM_Init(TMRWHEEL_TIMx, TIM_TIMER_MODE, &timerCfg);
+
+    if (TMRWHEEL_TIMx == LPC_TIM0)
+    {
+        pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_TIMER0);
+    }
+    else if (TMRWHEEL_TIMx == LPC_TIM1)
+    {
+        pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_TIMER1);
+    }
+    else if (TMRWHEEL_TIMx == LPC_TIM2)
+    {
+        pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_TIMER2);
+    }
+    else
+    {
+        pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_TIMER3);
+    }
+    TMRWHEEL_TickHz = pclk / timerCfg.PrescaleValue;
+
+    for (l = 0; l < TMRWHEEL_LEVELS; l++)
+    {
+        for (s = 0; s < TMRWHEEL_SLOTS; s++)
+        {
+            TMRWHEEL_Slots[l][s] = NULL;
+        }
+        TMRWHEEL_Occupied[l] = 0;
+    }
+    TMRWHEEL_Clock = 0;
+    TMRWHEEL_ReadyHead = NULL;
+    TMRWHEEL_ReadyTail = NULL;
+
+    /* Free running: interrupt on match only, no reset or stop */
+    TMRWHEEL_TIMx->MCR &= ~(TIM_INT_ON_MATCH(TMRWHEEL_Channel) | TIM_RESET_ON_MATCH(TMRWHEEL_Channel) |
+                            TIM_STOP_ON_MATCH(TMRWHEEL_Channel));
+    TIM_Cmd(TMRWHEEL_TIMx, ENABLE);
+}
+
+/*******************************************************************************
+ * @brief		Get the hardware counter
+ * @param[in]	None
+ * @return		Current counter value in ticks
+ *******************************************************************************/
+uint32_t TMRWHEEL_Now(void)
+{
+    return TMRWHEEL_TIMx->TC;
+}
+
+/*******************************************************************************
+ * @brief		Convert a time to timer ticks
+ * @param[in]	usec Time in microseconds
+ * @return		Number of ticks
+ *******************************************************************************/
+uint32_t TMRWHEEL_UsToTicks(uint32_t usec)
+{
+    return (uint32_t)(((uint64_t)TMRWHEEL_TickHz * usec) / 1000000UL);
+}
+
+/*******************************************************************************
+ * @brief		Initialize a software timer, not started
+ * @param[in]	timer Pointer to the timer
+ * @param[in]	callback Function called from TMRWHEEL_Dispatch() on expiry
+ * @param[in]	arg Argument passed to callback
+ * @return		None
+ *******************************************************************************/
+void TMRWHEEL_TimerInit(TMRWHEEL_Timer_Type* timer, TMRWHEEL_Callback callback, void* arg)
+{
+    timer->Next = NULL;
+    timer->Prev = NULL;
+    timer->ReadyNext = NULL;
+    timer->Expires = 0;
+    timer->Period = 0;
+    timer->Callback = callback;
+    timer->Arg = arg;
+    timer->Level = 0xFF;
+    timer->Slot = 0;
+    timer->Queued = 0;
+    timer->Pending = 0;
+}
+
+/*******************************************************************************
+ * @brief		Start or restart a software timer
+ * @param[in]	timer Pointer to a timer set up by TMRWHEEL_TimerInit()
+ * @param[in]	delay Ticks until the first expiry, up to TMRWHEEL_MAX_TICKS
+ * @param[in]	period Ticks between later expiries, up to TMRWHEEL_MAX_TICKS,
+ * 				0 for a one-shot timer
+ * @return		SUCCESS, or ERROR if delay or period is out of range
+ *******************************************************************************/
+Status TMRWHEEL_Start(TMRWHEEL_Timer_Type* timer, uint32_t delay, uint32_t period)
+{
+    uint32_t primask, now;
+
+    if ((delay > TMRWHEEL_MAX_TICKS) || (period > TMRWHEEL_MAX_TICKS))
+    {
+        return ERROR;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (timer->Level != 0xFF)
+    {
+        TMRWHEEL_Unlink(timer);
+    }
+    /* Bring the wheel up to date first, deltas are taken from its index */
+    now = TMRWHEEL_TIMx->TC;
+    TMRWHEEL_Advance(now);
+    timer->Expires = now + delay;
+    timer->Period = period;
+    timer->Pending = 0;
+    TMRWHEEL_Link(timer);
+    TMRWHEEL_Service();
+    __set_PRIMASK(primask);
+
+    return SUCCESS;
+}
+
+/*******************************************************************************
+ * @brief		Stop a software timer. An expiry not yet dispatched is dropped.
+ * @param[in]	timer Pointer to the timer
+ * @return		None
+ *******************************************************************************/
+void TMRWHEEL_Cancel(TMRWHEEL_Timer_Type* timer)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (timer->Level != 0xFF)
+    {
+        TMRWHEEL_Unlink(timer);
+    }
+    timer->Pending = 0;
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Check whether a software timer is started
+ * @param[in]	timer Pointer to the timer
+ * @return		TRUE if the timer will expire again
+ *******************************************************************************/
+Bool TMRWHEEL_IsActive(const TMRWHEEL_Timer_Type* timer)
+{
+    return (timer->Level != 0xFF) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ * @brief		Get the time until the wheel next needs the CPU
+ * @param[out]	ticks Ticks until the next programmed match, 0 if expired
+ * 				timers wait for TMRWHEEL_Dispatch() or the match has passed
+ * @return		FALSE if no timer is started and none is waiting
+ *******************************************************************************/
+Bool TMRWHEEL_GetNextDeadline(uint32_t* ticks)
+{
+    int32_t left;
+
+    if (TMRWHEEL_ReadyHead != NULL)
+    {
+        *ticks = 0;
+        return TRUE;
+    }
+    if ((TMRWHEEL_TIMx->MCR & TIM_INT_ON_MATCH(TMRWHEEL_Channel)) == 0)
+    {
+        return FALSE;
+    }
+    left = (int32_t)(*TMRWHEEL_MR - TMRWHEEL_TIMx->TC);
+    *ticks = (left > 0) ? (uint32_t)left : 0;
+    return TRUE;
+}
+
+/*******************************************************************************
+ * @brief		Bring the programmed match forward, so that a CPU woken by it
+ * 				is running again at the deadline. The early interrupt finds
+ * 				nothing due and programs the deadline again. Call with
+ * 				interrupts masked.
+ * @param[in]	ticks Ticks to bring the match forward by
+ * @return		FALSE, with the match unchanged, if no match is programmed
+ * 				or the earlier one would be passed already
+ *******************************************************************************/
+Bool TMRWHEEL_WakeEarly(uint32_t ticks)
+{
+    uint32_t match;
+
+    if ((TMRWHEEL_TIMx->MCR & TIM_INT_ON_MATCH(TMRWHEEL_Channel)) == 0)
+    {
+        return FALSE;
+    }
+    match = *TMRWHEEL_MR - ticks;
+    if ((int32_t)(match - TMRWHEEL_TIMx->TC) <= 0)
+    {
+        return FALSE;
+    }
+    *TMRWHEEL_MR = match;
+    /* The counter may have reached it while it was written */
+    if ((int32_t)(match - TMRWHEEL_TIMx->TC) <= 0)
+    {
+        *TMRWHEEL_MR = match + ticks;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*******************************************************************************
+ * @brief		Move the counter forward for time it did not count, e.g. while
+ * 				its clock was stopped in Deep-sleep, and expire what fell due
+ * @param[in]	ticks Ticks to add to the counter
+ * @return		None
+ *******************************************************************************/
+void TMRWHEEL_Adjust(uint32_t ticks)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    TMRWHEEL_TIMx->TC += ticks;
+    TMRWHEEL_Service();
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * @brief		Timer interrupt handler, call from TIMERn_IRQHandler() of the
+ * 				hardware timer given to TMRWHEEL_Init()
+ * @param[in]	None
+ * @return		None
+ *******************************************************************************/
+void TMRWHEEL_IRQHandler(void)
+{
+    TMRWHEEL_TIMx->IR = TIM_IR_CLR(TMRWHEEL_Channel);
+    TMRWHEEL_Service();
+}
+
+/*******************************************************************************
+ * @brief		Run the callbacks of expired timers. A timer that expired more
+ * 				than once since the last dispatch has its callback run once.
+ * @param[in]	None
+ * @return		Number of callbacks run
+ *******************************************************************************/
+uint32_t TMRWHEEL_Dispatch(void)
+{
+    TMRWHEEL_Timer_Type* timer;
+    uint32_t primask, pending, count = 0;
+
+    for (;;)
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        timer = TMRWHEEL_ReadyHead;
+        if (timer == NULL)
+        {
+            __set_PRIMASK(primask);
+            break;
+        }
+        TMRWHEEL_ReadyHead = timer->ReadyNext;
+        if (TMRWHEEL_ReadyHead == NULL)
+        {
+            TMRWHEEL_ReadyTail = NULL;
+        }
+        timer->Queued = 0;
+        pending = timer->Pending;
+        timer->Pending = 0;
+        __set_PRIMASK(primask);
+
+        if ((pending != 0) && (timer->Callback != NULL))
+        {
+            timer->Callback(timer->Arg);
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _TMRWHEEL */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,192 @@
+/**********************************************************************
+ * $Id$		bench_dmacpy.c				2026-10-18
+ *//**
+* @file		bench_dmacpy.c
+* @brief	Host benchmark of the DMACPY CPU/DMA crossover: the CPU time of
+* 			a CPU copy or fill against the CPU time of the DMA path
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include <string.h>
+#include "../src/lpc17xx_clkpwr.c"
+#include "../src/lpc17xx_gpdma.c"
+#include "../src/lpc17xx_dmacpy.c"
+
+/* The host has no DMA engine: Model_Engine() plays it after each call,
+ * running the armed channels to their terminal count and the interrupt
+ * handler, until the operation is done. Off the clock the engine moves the
+ * data, to check it; on the clock it only completes the transfers, the
+ * CPU is free while a real engine copies.
+ *
+ * So the DMA figure is the CPU cost of the DMA path, allocation, arming,
+ * interrupt and callbacks included, and the crossover is the size from
+ * which handing a copy to the DMA costs the CPU less than doing it. The
+ * completion time crossover depends on the AHB timing of the target, use
+ * DMACPY_Calibrate() there. */
+
+#define RUNS (2000)
+#define MAX_LEN (8192)
+
+/** AHB SRAM: source, destination and the operation, whose fill word is a
+ * DMA source */
+#define SRC_ADDR (0x2007C000UL)
+#define DST_ADDR (SRC_ADDR + MAX_LEN)
+#define OP_ADDR (DST_ADDR + MAX_LEN)
+
+/** Read-only registers are written by the model */
+#define MODEL_REG(reg) (*(volatile uint32_t*)&(reg))
+
+static volatile uint32_t Done;
+
+static void Callback(void* arg)
+{
+    Done++;
+}
+
+/** Run the enabled channels to the terminal count, then the interrupt */
+static void Model_Engine(Bool move)
+{
+    LPC_GPDMACH_TypeDef* ch;
+    uint32_t n, tc, words, i;
+    volatile uint32_t *src, *dst;
+
+    for (;;)
+    {
+        tc = 0;
+        for (n = 0; n < 8; n++)
+        {
+            ch = (LPC_GPDMACH_TypeDef*)pGPDMACh[n];
+            if (!(ch->DMACCConfig & GPDMA_DMACCxConfig_E))
+            {
+                continue;
+            }
+            if (move)
+            {
+                words = ch->DMACCControl & 0xFFF;
+                src = (volatile uint32_t*)(uintptr_t)ch->DMACCSrcAddr;
+                dst = (volatile uint32_t*)(uintptr_t)ch->DMACCDestAddr;
+                for (i = 0; i < words; i++)
+                {
+                    *dst = *src;
+                    dst += (ch->DMACCControl & GPDMA_DMACCxControl_DI) ? 1 : 0;
+                    src += (ch->DMACCControl & GPDMA_DMACCxControl_SI) ? 1 : 0;
+                }
+            }
+            ch->DMACCConfig &= ~GPDMA_DMACCxConfig_E;
+            tc |= 1 << n;
+        }
+        if (!tc)
+        {
+            return;
+        }
+        MODEL_REG(LPC_GPDMA->DMACIntTCStat) = tc;
+        MODEL_REG(LPC_GPDMA->DMACIntStat) = tc;
+        GPDMA_IntHandler();
+        MODEL_REG(LPC_GPDMA->DMACIntTCStat) = 0;
+        MODEL_REG(LPC_GPDMA->DMACIntStat) = 0;
+    }
+}
+
+/** One operation, copy or fill of len bytes */
+static void Run(Bool fill, uint32_t len)
+{
+    DMACPY_Op_Type* op = (DMACPY_Op_Type*)OP_ADDR;
+
+    if (fill)
+    {
+        DMACPY_Set(op, (void*)DST_ADDR, 0x5A, len, Callback, NULL);
+    }
+    else
+    {
+        DMACPY_Copy(op, (void*)DST_ADDR, (const void*)SRC_ADDR, len, Callback, NULL);
+    }
+}
+
+/** Nanoseconds per operation on the CPU, or the DMA path with threshold 0 */
+static double Time(Bool fill, Bool dma, uint32_t len)
+{
+    uint64_t t0;
+    uint32_t i;
+
+    DMACPY_SetThreshold(dma ? 0 : 0xFFFFFFFF);
+    t0 = HOST_Nanos();
+    for (i = 0; i < RUNS; i++)
+    {
+        Run(fill, len);
+        Model_Engine(FALSE);
+    }
+    return (double)(HOST_Nanos() - t0) / RUNS;
+}
+
+/** The DMA path moves the right bytes, the operation completes once */
+static Bool Verify(Bool fill, uint32_t len)
+{
+    uint8_t* src = (uint8_t*)SRC_ADDR;
+    uint8_t* dst = (uint8_t*)DST_ADDR;
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        src[i] = (uint8_t)(i * 7 + len);
+    }
+    memset(dst, 0, len);
+    Done = 0;
+    DMACPY_SetThreshold(0);
+    Run(fill, len);
+    Model_Engine(TRUE);
+
+    if ((Done != 1) || !DMACPY_IsDone((DMACPY_Op_Type*)OP_ADDR) || (GPDMA_ChAlloc != 0))
+    {
+        return FALSE;
+    }
+    for (i = 0; i < len; i++)
+    {
+        if (dst[i] != (fill ? 0x5A : src[i]))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void Crossover(Bool fill)
+{
+    uint32_t len, crossover = 0;
+    double cpu, dma;
+
+    printf("  %s\n  %8s %12s %12s\n", fill ? "DMACPY_Set" : "DMACPY_Copy", "bytes", "cpu ns", "dma path ns");
+    for (len = 16; len <= MAX_LEN; len <<= 1)
+    {
+        cpu = Time(fill, FALSE, len);
+        dma = Time(fill, TRUE, len);
+        printf("  %8u %12.1f %12.1f%s\n", (unsigned)len, cpu, dma, Verify(fill, len) ? "" : "  data mismatch");
+        if (!crossover && (dma <= cpu))
+        {
+            crossover = len;
+        }
+    }
+    if (crossover)
+    {
+        printf("  crossover: %u bytes\n", (unsigned)crossover);
+    }
+    else
+    {
+        printf("  crossover: above %u bytes\n", (unsigned)MAX_LEN);
+    }
+}
+
+int main(void)
+{
+    HOST_Init();
+    GPDMA_Init();
+    DMACPY_Init();
+
+    printf("bench_dmacpy: CPU time per operation, %u runs\n", RUNS);
+    Crossover(FALSE);
+    Crossover(TRUE);
+
+    return 0;
+}
+
+/* --------------------------------- End Of File ------------------------------ */
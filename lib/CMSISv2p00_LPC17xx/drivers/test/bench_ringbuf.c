@@ -0,0 +1,106 @@
+/**********************************************************************
+ * $Id$		bench_ringbuf.c				2026-10-18
+ *//**
+* @file		bench_ringbuf.c
+* @brief	Host benchmark of MAVG against the loop-and-divide sample
+* 			histories of the exercises
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include "lpc17xx_ringbuf.h"
+
+#define SAMPLES (1000000)
+
+MAVG_DECLARE(Hist32, uint16_t, uint32_t, 32)
+MAVG_DECLARE(Hist128, uint16_t, uint32_t, 128)
+
+/** Keeps the results alive */
+static volatile uint32_t Sink;
+
+/* The exercises' history (p2022-ej1 buffer_canal_2): uint8_t index with a
+ * compare-and-wrap, average recomputed over the whole buffer */
+#define LOOP_DECLARE(name, n)                                                                                      \
+    static uint16_t name##_buffer[n];                                                                              \
+    static uint8_t name##_indice;                                                                                  \
+    static void name##_Push(uint16_t valor)                                                                        \
+    {                                                                                                              \
+        name##_buffer[name##_indice] = valor;                                                                      \
+        name##_indice++;                                                                                           \
+        if (name##_indice == (n))                                                                                  \
+        {                                                                                                          \
+            name##_indice = 0;                                                                                     \
+        }                                                                                                          \
+    }                                                                                                              \
+    static uint32_t name##_Average(void)                                                                           \
+    {                                                                                                              \
+        uint32_t suma = 0;                                                                                         \
+        uint8_t i;                                                                                                 \
+        for (i = 0; i < (n); i++)                                                                                  \
+        {                                                                                                          \
+            suma += name##_buffer[i];                                                                              \
+        }                                                                                                          \
+        return suma / (n);                                                                                         \
+    }
+
+LOOP_DECLARE(Loop32, 32)
+LOOP_DECLARE(Loop128, 128)
+
+/** Pseudo-random 12 bit ADC samples */
+static uint16_t Sample(uint32_t i)
+{
+    return (uint16_t)((i * 2654435761u) >> 20);
+}
+
+static void Report(const char* name, uint64_t t0, uint64_t t1)
+{
+    printf("  %-28s %6.2f ns/sample\n", name, (double)(t1 - t0) / SAMPLES);
+}
+
+int main(void)
+{
+    static Hist32_Type h32;
+    static Hist128_Type h128;
+    uint64_t t0;
+    uint32_t i;
+
+    printf("bench_ringbuf: push + average per sample, %u samples\n", SAMPLES);
+
+    t0 = HOST_Nanos();
+    for (i = 0; i < SAMPLES; i++)
+    {
+        Loop32_Push(Sample(i));
+        Sink = Loop32_Average();
+    }
+    Report("loop-and-divide, 32", t0, HOST_Nanos());
+
+    Hist32_Init(&h32);
+    t0 = HOST_Nanos();
+    for (i = 0; i < SAMPLES; i++)
+    {
+        Hist32_Push(&h32, Sample(i));
+        Sink = Hist32_Average(&h32);
+    }
+    Report("MAVG running sum, 32", t0, HOST_Nanos());
+
+    t0 = HOST_Nanos();
+    for (i = 0; i < SAMPLES; i++)
+    {
+        Loop128_Push(Sample(i));
+        Sink = Loop128_Average();
+    }
+    Report("loop-and-divide, 128", t0, HOST_Nanos());
+
+    Hist128_Init(&h128);
+    t0 = HOST_Nanos();
+    for (i = 0; i < SAMPLES; i++)
+    {
+        Hist128_Push(&h128, Sample(i));
+        Sink = Hist128_Average(&h128);
+    }
+    Report("MAVG running sum, 128", t0, HOST_Nanos());
+
+    return 0;
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,117 @@
+/**********************************************************************
+ * $Id$		bench_task.c				2026-10-18
+ *//**
+* @file		bench_task.c
+* @brief	Host benchmark of the TASK runtime context switch: yield
+* 			round robin and event hand-off
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include "../src/lpc17xx_clkpwr.c"
+#include "../src/lpc17xx_timer.c"
+#include "../src/lpc17xx_tmrwheel.c"
+#include "../src/lpc17xx_task.c"
+
+#define RUNS (1000000)
+
+static TASK_Type TaskA, TaskB, TaskC, TaskD;
+static TASK_Event_Type Handoff = TASK_EVENT_INIT;
+static volatile uint32_t Counter;
+static volatile Bool Stop;
+
+/** Calls through a pointer, the floor under any dispatcher */
+static TASK_RESULT_Type Plain(TASK_Type* t)
+{
+    Counter++;
+    return TASK_YIELDED;
+}
+
+static TASK_RESULT_Type Yielder(TASK_Type* t)
+{
+    TASK_BEGIN(t);
+    while (!Stop)
+    {
+        Counter++;
+        TASK_YIELD(t);
+    }
+    TASK_END(t);
+}
+
+static TASK_RESULT_Type Producer(TASK_Type* t)
+{
+    TASK_BEGIN(t);
+    for (;;)
+    {
+        TASK_EventSignal(&Handoff);
+        TASK_YIELD(t);
+    }
+    TASK_END(t);
+}
+
+static TASK_RESULT_Type Consumer(TASK_Type* t)
+{
+    TASK_BEGIN(t);
+    for (;;)
+    {
+        TASK_AWAIT_EVENT(t, &Handoff);
+        Counter++;
+    }
+    TASK_END(t);
+}
+
+static void Report(const char* name, uint64_t t0, uint64_t t1, uint32_t switches)
+{
+    printf("  %-30s %6.2f ns/switch\n", name, (double)(t1 - t0) / switches);
+}
+
+int main(void)
+{
+    static const TMRWHEEL_CFG_Type wheel = {LPC_TIM0, 0, 1};
+    TASK_Func volatile call = Plain;
+    uint64_t t0;
+    uint32_t i, switches;
+
+    HOST_Init();
+    TMRWHEEL_Init(&wheel);
+
+    printf("bench_task: %u scheduler runs\n", RUNS);
+
+    t0 = HOST_Nanos();
+    for (i = 0; i < 2 * RUNS; i++)
+    {
+        call(&TaskA);
+    }
+    Report("function pointer call", t0, HOST_Nanos(), 2 * RUNS);
+
+    TASK_Start(&TaskA, Yielder, NULL);
+    TASK_Start(&TaskB, Yielder, NULL);
+    Counter = 0;
+    switches = 0;
+    t0 = HOST_Nanos();
+    for (i = 0; i < RUNS; i++)
+    {
+        switches += TASK_Run();
+    }
+    Report("yield, 2 tasks round robin", t0, HOST_Nanos(), switches);
+
+    /* Finish the yielders, a task must not be started again while queued */
+    Stop = TRUE;
+    TASK_Run();
+
+    TASK_Start(&TaskC, Consumer, NULL);
+    TASK_Start(&TaskD, Producer, NULL);
+    Counter = 0;
+    switches = 0;
+    t0 = HOST_Nanos();
+    for (i = 0; i < RUNS; i++)
+    {
+        switches += TASK_Run();
+    }
+    Report("event signal, wake and take", t0, HOST_Nanos(), switches);
+    printf("  %u hand-offs in %u task runs\n", (unsigned)Counter, (unsigned)switches);
+
+    return 0;
+}
+
+/* --------------------------------- End Of File ------------------------------ */
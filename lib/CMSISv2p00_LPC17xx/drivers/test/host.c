@@ -0,0 +1,194 @@
+/**********************************************************************
+ * $Id$		host.c				2026-10-18
+ *//**
+* @file		host.c
+* @brief	Host side of the driver tests: memory map, parameter check
+* 			hook and reporting
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <ucontext.h>
+#include "lpc_types.h"
+
+uint32_t HOST_Primask;
+void (*HOST_WfiHook)(void);
+uint32_t HOST_Checks;
+uint32_t HOST_Failures;
+
+/** Read by the clock dependent drivers, the default LPC1769 setup */
+uint32_t SystemCoreClock = 100000000;
+
+/** Regions mapped at their LPC17xx address */
+static const struct
+{
+    uintptr_t Base;
+    size_t Size;
+    uint8_t Fill;
+} HOST_Regions[] = {
+    {HOST_FLASH_BASE, HOST_FLASH_END - HOST_FLASH_BASE, 0xFF}, /* Flash sectors 16..29 */
+    {0x10000000, 0x8000, 0x00},                                /* Local SRAM */
+    {0x2007C000, 0x8000, 0x00},                                /* AHB SRAM banks 0 and 1 */
+    {0x2009C000, 0x4000, 0x00},                                /* GPIO */
+    {0x40000000, 0x100000, 0x00},                              /* APB0, APB1 */
+    {0x50000000, 0x200000, 0x00},                              /* AHB peripherals */
+    {0xE0000000, 0x100000, 0x00},                              /* Private peripheral bus */
+};
+
+void HOST_Init(void)
+{
+    uint32_t i;
+    void* p;
+
+    for (i = 0; i < sizeof(HOST_Regions) / sizeof(HOST_Regions[0]); i++)
+    {
+        p = mmap((void*)HOST_Regions[i].Base, HOST_Regions[i].Size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (p != (void*)HOST_Regions[i].Base)
+        {
+            printf("cannot map 0x%08lx\n", (unsigned long)HOST_Regions[i].Base);
+            exit(2);
+        }
+        memset(p, HOST_Regions[i].Fill, HOST_Regions[i].Size);
+    }
+}
+
+HOST_TRACE_Type HOST_Trace[HOST_TRACE_MAX];
+uint32_t HOST_TraceCount;
+void (*HOST_StoreHook)(uint32_t addr);
+
+#define HOST_PAGE(a) ((uintptr_t)(a) & ~(uintptr_t)0xFFF)
+#define HOST_TRACE_PAGES (4)
+
+static uintptr_t HOST_TracePages[HOST_TRACE_PAGES];
+static uint32_t HOST_TraceNumPages;
+/** Address of the store being single-stepped */
+static uintptr_t HOST_TraceAddr;
+
+#if defined(__x86_64__) && defined(__linux__)
+/** Trap flag of RFLAGS, single step */
+#define HOST_EFLAGS_TF (0x100)
+
+static Bool HOST_TracePage(uintptr_t page)
+{
+    uint32_t i;
+
+    for (i = 0; i < HOST_TraceNumPages; i++)
+    {
+        if (HOST_TracePages[i] == page)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/** A store to a traced page: open it and step over the store */
+static void HOST_TraceFault(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+    uintptr_t addr = (uintptr_t)info->si_addr;
+
+    if (!HOST_TracePage(HOST_PAGE(addr)))
+    {
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+    HOST_TraceAddr = addr;
+    mprotect((void*)HOST_PAGE(addr), 0x1000, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= HOST_EFLAGS_TF;
+}
+
+/** The store is done: record it and close the page again */
+static void HOST_TraceStep(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+    uintptr_t addr = HOST_TraceAddr & ~(uintptr_t)3;
+
+    if (HOST_TraceCount < HOST_TRACE_MAX)
+    {
+        HOST_Trace[HOST_TraceCount].Addr = (uint32_t)addr;
+        HOST_Trace[HOST_TraceCount].Value = *(volatile uint32_t*)addr;
+        HOST_TraceCount++;
+    }
+    if (HOST_StoreHook)
+    {
+        HOST_StoreHook((uint32_t)addr);
+    }
+    mprotect((void*)HOST_PAGE(addr), 0x1000, PROT_READ);
+    uc->uc_mcontext.gregs[REG_EFL] &= ~HOST_EFLAGS_TF;
+}
+
+int HOST_TraceStart(const uint32_t* addrs, uint32_t num)
+{
+    struct sigaction sa;
+    uint32_t i;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = HOST_TraceFault;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = HOST_TraceStep;
+    sigaction(SIGTRAP, &sa, NULL);
+
+    HOST_TraceCount = 0;
+    HOST_TraceNumPages = 0;
+    for (i = 0; (i < num) && (i < HOST_TRACE_PAGES); i++)
+    {
+        HOST_TracePages[HOST_TraceNumPages++] = HOST_PAGE(addrs[i]);
+        mprotect((void*)HOST_PAGE(addrs[i]), 0x1000, PROT_READ);
+    }
+    return 1;
+}
+
+void HOST_TraceStop(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < HOST_TraceNumPages; i++)
+    {
+        mprotect((void*)HOST_TracePages[i], 0x1000, PROT_READ | PROT_WRITE);
+    }
+    HOST_TraceNumPages = 0;
+    signal(SIGSEGV, SIG_DFL);
+    signal(SIGTRAP, SIG_DFL);
+}
+#else
+int HOST_TraceStart(const uint32_t* addrs, uint32_t num)
+{
+    HOST_TraceCount = 0;
+    return 0;
+}
+
+void HOST_TraceStop(void)
+{
+}
+#endif
+
+/** CHECK_PARAM() failures are test failures */
+void check_failed(uint8_t* file, uint32_t line)
+{
+    HOST_Failures++;
+    printf("%s:%u: CHECK_PARAM failed\n", (const char*)file, (unsigned)line);
+}
+
+int HOST_Report(const char* name)
+{
+    printf("%s: %u checks, %u failed\n", name, (unsigned)HOST_Checks, (unsigned)HOST_Failures);
+    return HOST_Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+uint64_t HOST_Nanos(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* --------------------------------- End Of File ------------------------------ */
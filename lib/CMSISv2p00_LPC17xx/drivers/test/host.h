@@ -0,0 +1,164 @@
+/**********************************************************************
+ * $Id$		host.h				2026-10-18
+ *//**
+* @file		host.h
+* @brief	Host build shim for the driver tests: Cortex-M3 intrinsics in
+* 			plain C, the peripheral and memory map backed by host RAM, and
+* 			the check macros. Force-included ahead of every source.
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#ifndef HOST_H_
+#define HOST_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Intrinsics ----------------------------------------------------------------- */
+/* core_cmInstr.h and core_cmFunc.h are kept out with their include guards
+ * (see the Makefile), these stand in for them. PRIMASK is a plain variable:
+ * the tests run the interrupt handlers by hand. */
+
+extern uint32_t HOST_Primask;
+/** Called by __WFI(), the test plays the wake-up interrupt here */
+extern void (*HOST_WfiHook)(void);
+
+static inline void __NOP(void)
+{
+}
+static inline void __WFI(void)
+{
+    if (HOST_WfiHook)
+    {
+        HOST_WfiHook();
+    }
+}
+static inline void __WFE(void)
+{
+}
+static inline void __SEV(void)
+{
+}
+static inline void __ISB(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+static inline void __DSB(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+static inline void __DMB(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+static inline uint32_t __REV(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+static inline uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0xFF00FF00) >> 8) | ((value & 0x00FF00FF) << 8);
+}
+static inline int32_t __REVSH(int32_t value)
+{
+    return (int16_t)(((value & 0xFF00) >> 8) | ((value & 0x00FF) << 8));
+}
+static inline uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0;
+    int i;
+
+    for (i = 0; i < 32; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1);
+    }
+    return result;
+}
+static inline uint8_t __CLZ(uint32_t value)
+{
+    return value ? (uint8_t)__builtin_clz(value) : 32;
+}
+static inline void __CLREX(void)
+{
+}
+static inline void __enable_irq(void)
+{
+    HOST_Primask = 0;
+}
+static inline void __disable_irq(void)
+{
+    HOST_Primask = 1;
+}
+static inline uint32_t __get_PRIMASK(void)
+{
+    return HOST_Primask;
+}
+static inline void __set_PRIMASK(uint32_t priMask)
+{
+    HOST_Primask = priMask & 1;
+}
+static inline uint32_t __get_IPSR(void)
+{
+    return 0;
+}
+
+/* Memory map ----------------------------------------------------------------- */
+/** Map the peripheral, SRAM and flash regions the drivers address at their
+ * LPC17xx addresses, zero filled, flash erased. Sectors 0..15 (0x00000000)
+ * cannot be mapped on the host, the flash starts at sector 16. */
+void HOST_Init(void);
+
+/** First host-backed flash address, sector 16 */
+#define HOST_FLASH_BASE (0x00010000UL)
+/** End of the host-backed flash, after sector 29 */
+#define HOST_FLASH_END (0x00080000UL)
+
+/* Register trace ------------------------------------------------------------- */
+/** One traced store: the address and the word there after the store */
+typedef struct
+{
+    uint32_t Addr;
+    uint32_t Value;
+} HOST_TRACE_Type;
+
+#define HOST_TRACE_MAX (256)
+
+extern HOST_TRACE_Type HOST_Trace[HOST_TRACE_MAX];
+extern uint32_t HOST_TraceCount;
+
+/** Record every store to the 4 kB pages holding the given addresses, until
+ * HOST_TraceStop(). The pages are made read-only and each faulting store is
+ * single-stepped (x86-64 Linux only). Returns 0 if tracing is unsupported. */
+int HOST_TraceStart(const uint32_t* addrs, uint32_t num);
+void HOST_TraceStop(void);
+
+/** Called after each traced store, with the page still writable, so a
+ * model can play the hardware reacting to the store */
+extern void (*HOST_StoreHook)(uint32_t addr);
+
+/* Checks --------------------------------------------------------------------- */
+extern uint32_t HOST_Checks;
+extern uint32_t HOST_Failures;
+
+/** Count a check, report it if it fails, keep going */
+#define HOST_CHECK(expr)                                                                                         \
+    do                                                                                                           \
+    {                                                                                                            \
+        HOST_Checks++;                                                                                           \
+        if (!(expr))                                                                                             \
+        {                                                                                                        \
+            HOST_Failures++;                                                                                     \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #expr);                                      \
+        }                                                                                                        \
+    } while (0)
+
+/** Print the totals, returns the exit status of the test */
+int HOST_Report(const char* name);
+
+/** Nanoseconds from a monotonic clock, for the host benchmarks */
+uint64_t HOST_Nanos(void);
+
+#endif /* HOST_H_ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,117 @@
+/**********************************************************************
+ * $Id$		test_bitband.c				2026-10-18
+ *//**
+* @file		test_bitband.c
+* @brief	Host test of the BITBAND alias addresses against the
+* 			Cortex-M3 bit-band formula
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include "lpc17xx_bitband.h"
+
+/** The formula of the Cortex-M3 Technical Reference Manual:
+ * bit_word_addr = bit_band_base + byte_offset * 32 + bit_number * 4 */
+static uint32_t Reference(uint32_t addr, uint32_t bit)
+{
+    uint32_t region = (addr >= 0x40000000UL) ? 0x40000000UL : 0x20000000UL;
+    uint32_t bitBandBase = region + 0x02000000UL;
+
+    return bitBandBase + (addr - region) * 32 + bit * 4;
+}
+
+/** Every byte and bit of both regions */
+static void Test_Regions(void)
+{
+    static const uint32_t regions[2] = {BITBAND_SRAM_BASE, BITBAND_PERI_BASE};
+    uint32_t r, offset, bit, addr, alias;
+    uint32_t mismatches = 0, outside = 0;
+
+    for (r = 0; r < 2; r++)
+    {
+        for (offset = 0; offset < BITBAND_REGION_SIZE; offset++)
+        {
+            addr = regions[r] + offset;
+            if (!PARAM_BITBAND_ADDR(addr))
+            {
+                outside++;
+            }
+            for (bit = 0; bit < 8; bit++)
+            {
+                alias = BITBAND_ALIAS(addr, bit);
+                if (alias != Reference(addr, bit))
+                {
+                    mismatches++;
+                }
+                /* Back from the alias word to the byte and the bit */
+                if ((regions[r] + ((alias & 0x01FFFFFFUL) >> 5) != addr) || (((alias >> 2) & 7) != bit))
+                {
+                    mismatches++;
+                }
+            }
+        }
+    }
+    HOST_CHECK(mismatches == 0);
+    HOST_CHECK(outside == 0);
+
+    /* Word addresses with bits 8..31 land in the following bytes' words */
+    HOST_CHECK(BITBAND_ALIAS(0x2009C014UL, 22) == BITBAND_ALIAS(0x2009C016UL, 6));
+    HOST_CHECK(BITBAND_ALIAS(0x400FC0C4UL, 31) == Reference(0x400FC0C4UL, 31));
+
+    /* Neither the regions' neighbours nor the AHB peripherals */
+    HOST_CHECK(!PARAM_BITBAND_ADDR(BITBAND_SRAM_BASE - 4));
+    HOST_CHECK(!PARAM_BITBAND_ADDR(BITBAND_SRAM_BASE + BITBAND_REGION_SIZE));
+    HOST_CHECK(!PARAM_BITBAND_ADDR(BITBAND_PERI_BASE + BITBAND_REGION_SIZE));
+    HOST_CHECK(!PARAM_BITBAND_ADDR(LPC_GPDMA_BASE));
+    HOST_CHECK(!PARAM_BITBAND_ADDR(0x10000000UL));
+}
+
+/** The lvalue macros on real register names */
+static void Test_Registers(void)
+{
+#define CHECK_REG(reg, bit)                                                                                          \
+    HOST_CHECK((uint32_t)(uintptr_t)&BITBAND_REG(reg, bit) == Reference((uint32_t)(uintptr_t)&(reg), bit))
+
+    CHECK_REG(LPC_GPIO0->FIOPIN, 22);
+    CHECK_REG(LPC_GPIO0->FIODIR, 0);
+    CHECK_REG(LPC_GPIO1->FIOPIN, 31);
+    CHECK_REG(LPC_GPIO2->FIODIR, 13);
+    CHECK_REG(LPC_GPIO4->FIOPIN, 29);
+    CHECK_REG(LPC_RIT->RICTRL, 0);
+    CHECK_REG(LPC_RIT->RICTRL, 3);
+    CHECK_REG(LPC_TIM0->IR, 1);
+    CHECK_REG(LPC_TIM3->TCR, 0);
+    CHECK_REG(LPC_SC->PCONP, 15);
+    CHECK_REG(LPC_SC->EXTINT, 0);
+    CHECK_REG(LPC_ADC->ADCR, 16);
+    CHECK_REG(LPC_UART0->IER, 1);
+    CHECK_REG(LPC_PINCON->PINSEL0, 31);
+
+    /* Pin macros address the pin's port */
+    HOST_CHECK((uint32_t)(uintptr_t)&BITBAND_REG(BITBAND_GPIO(3)->FIOPIN, 25) ==
+               BITBAND_SRAM_BASE + BITBAND_ALIAS_OFFSET + (LPC_GPIO3_BASE + 0x14 - BITBAND_SRAM_BASE) * 32 + 25 * 4);
+}
+
+/** BITBAND_PIN_SET() and _CLR() are plain stores, runnable on the host */
+static void Test_PinStores(void)
+{
+    BITBAND_PIN_SET(2, 5);
+    HOST_CHECK(LPC_GPIO2->FIOSET == (1UL << 5));
+    BITBAND_PIN_CLR(0, 22);
+    HOST_CHECK(LPC_GPIO0->FIOCLR == (1UL << 22));
+    BITBAND_PIN_SET(1, 31);
+    HOST_CHECK(LPC_GPIO1->FIOSET == (1UL << 31));
+}
+
+int main(void)
+{
+    HOST_Init();
+
+    Test_Regions();
+    Test_Registers();
+    Test_PinStores();
+
+    return HOST_Report("test_bitband");
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,226 @@
+/**********************************************************************
+ * $Id$		test_dmapace.c				2026-10-18
+ *//**
+* @file		test_dmapace.c
+* @brief	Host test of the timer-paced copier DMAPACE and of the GPIO
+* 			pattern player DMAPAT built on it
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include <string.h>
+#include "../src/lpc17xx_clkpwr.c"
+#include "../src/lpc17xx_timer.c"
+#include "../src/lpc17xx_gpdma.c"
+#include "../src/lpc17xx_dmapace.c"
+#include "../src/lpc17xx_dmapat.c"
+
+/* No DMA engine: the tests check the channel registers and linked list
+ * items left by a start, and raise the terminal count interrupt by hand. */
+
+/** Read-only registers are written by the model */
+#define MODEL_REG(reg) (*(volatile uint32_t*)&(reg))
+
+#define SRC_ADDR (0x2007C000UL)
+#define DST_ADDR (0x2007D000UL)
+
+static GPDMA_LLI_Type Lli[4];
+static uint32_t Ends;
+
+static void Callback(void* arg)
+{
+    Ends++;
+}
+
+static void Reset(void)
+{
+    memset((void*)LPC_GPDMA_BASE, 0, 0x200);
+    LPC_SC->DMAREQSEL = 0;
+    GPDMA_Init();
+    memset(Lli, 0, sizeof(Lli));
+    Ends = 0;
+}
+
+static LPC_GPDMACH_TypeDef* Channel(const DMAPACE_Type* pace)
+{
+    return (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + pace->ChannelNum * 0x20);
+}
+
+/** Terminal count of the copier channel, through the GPDMA dispatcher */
+static void Model_TC(const DMAPACE_Type* pace)
+{
+    Channel(pace)->DMACCConfig &= ~GPDMA_DMACCxConfig_E;
+    MODEL_REG(LPC_GPDMA->DMACIntTCStat) = 1 << pace->ChannelNum;
+    GPDMA_IntHandler();
+    MODEL_REG(LPC_GPDMA->DMACIntTCStat) = 0;
+}
+
+static void Start(DMAPACE_Type* pace, uint8_t srcInc, uint8_t dstInc)
+{
+    DMAPACE_CFG_Type cfg = {LPC_TIM1, 1, GPDMA_WIDTH_HALFWORD, 0, 0, 1000000, GPDMA_PRIO_LOW};
+
+    cfg.SrcInc = srcInc;
+    cfg.DstInc = dstInc;
+    Reset();
+    HOST_CHECK(DMAPACE_Init(pace, &cfg) == SUCCESS);
+}
+
+/* Tests ---------------------------------------------------------------------- */
+static void Test_Init(void)
+{
+    DMAPACE_Type pace;
+
+    Start(&pace, TRUE, FALSE);
+    /* Timer from CCLK (100 MHz), reset on MR1 every 100 counts */
+    HOST_CHECK(CLKPWR_GetPCLK(CLKPWR_PCLKSEL_TIMER1) == 100000000);
+    HOST_CHECK(LPC_TIM1->MR1 == 99);
+    HOST_CHECK(LPC_TIM1->MCR == TIM_RESET_ON_MATCH(1));
+    /* MAT1.1 replaces UART request 11 */
+    HOST_CHECK(LPC_SC->DMAREQSEL == (1 << 3));
+    HOST_CHECK(((pace.Config >> 6) & 0x1F) == 11);
+    HOST_CHECK(LPC_GPDMA->DMACConfig & GPDMA_DMACConfig_E);
+    HOST_CHECK(!DMAPACE_IsBusy(&pace));
+}
+
+static void Test_Chunks(void)
+{
+    DMAPACE_Type pace;
+    LPC_GPDMACH_TypeDef* ch;
+    uint32_t i;
+
+    Start(&pace, TRUE, FALSE);
+    ch = Channel(&pace);
+    HOST_CHECK(DMAPACE_LLI_COUNT(DMAPACE_MAX_CHUNK) == 1);
+    HOST_CHECK(DMAPACE_LLI_COUNT(10000) == 3);
+    HOST_CHECK(DMAPACE_Copy(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 10000, Lli, 2, Callback, NULL) == ERROR);
+    HOST_CHECK(DMAPACE_Copy(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 10000, Lli, 3, Callback, NULL) == SUCCESS);
+
+    /* Half-words: the source steps 2 * 4095 bytes per chunk, the destination stays */
+    for (i = 0; i < 3; i++)
+    {
+        HOST_CHECK(Lli[i].SrcAddr == SRC_ADDR + i * 2 * DMAPACE_MAX_CHUNK);
+        HOST_CHECK(Lli[i].DstAddr == DST_ADDR);
+        HOST_CHECK((Lli[i].Control & 0xFFF) == ((i < 2) ? DMAPACE_MAX_CHUNK : 10000 - 2 * DMAPACE_MAX_CHUNK));
+        HOST_CHECK(!(Lli[i].Control & GPDMA_DMACCxControl_I) == (i < 2));
+    }
+    HOST_CHECK(Lli[0].NextLLI == (uint32_t)&Lli[1]);
+    HOST_CHECK(Lli[1].NextLLI == (uint32_t)&Lli[2]);
+    HOST_CHECK(Lli[2].NextLLI == 0);
+
+    /* The channel starts on the first item */
+    HOST_CHECK(ch->DMACCSrcAddr == Lli[0].SrcAddr);
+    HOST_CHECK(ch->DMACCDestAddr == DST_ADDR);
+    HOST_CHECK(ch->DMACCLLI == Lli[0].NextLLI);
+    HOST_CHECK(ch->DMACCControl == Lli[0].Control);
+    HOST_CHECK(ch->DMACCConfig == (pace.Config | GPDMA_DMACCxConfig_E));
+    HOST_CHECK(LPC_TIM1->TCR == TIM_ENABLE);
+
+    /* Busy until the terminal count of the last item */
+    HOST_CHECK(DMAPACE_IsBusy(&pace));
+    HOST_CHECK(DMAPACE_Copy(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 10, NULL, 0, Callback, NULL) == ERROR);
+    Model_TC(&pace);
+    HOST_CHECK(Ends == 1);
+    HOST_CHECK(!DMAPACE_IsBusy(&pace));
+    HOST_CHECK(!pace.Failed);
+    HOST_CHECK(LPC_TIM1->TCR == 0);
+}
+
+static void Test_Single(void)
+{
+    DMAPACE_Type pace;
+    LPC_GPDMACH_TypeDef* ch;
+
+    /* A single chunk copied once needs no linked list item */
+    Start(&pace, FALSE, TRUE);
+    ch = Channel(&pace);
+    HOST_CHECK(DMAPACE_Copy(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, DMAPACE_MAX_CHUNK + 1, NULL, 0, NULL, NULL) ==
+               ERROR);
+    HOST_CHECK(DMAPACE_Loop(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 16, NULL, 0) == ERROR);
+    HOST_CHECK(DMAPACE_Copy(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 0, Lli, 4, NULL, NULL) == ERROR);
+    HOST_CHECK(DMAPACE_Copy(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 16, NULL, 0, Callback, NULL) == SUCCESS);
+    HOST_CHECK(ch->DMACCSrcAddr == SRC_ADDR);
+    HOST_CHECK(ch->DMACCDestAddr == DST_ADDR);
+    HOST_CHECK(ch->DMACCLLI == 0);
+    HOST_CHECK(ch->DMACCControl == (pace.Control | GPDMA_DMACCxControl_TransferSize(16) | GPDMA_DMACCxControl_I));
+    HOST_CHECK(pace.Control & GPDMA_DMACCxControl_DI);
+    HOST_CHECK(!(pace.Control & GPDMA_DMACCxControl_SI));
+    Model_TC(&pace);
+    HOST_CHECK(Ends == 1);
+}
+
+static void Test_Loop(void)
+{
+    DMAPACE_Type pace;
+    LPC_GPDMACH_TypeDef* ch;
+
+    Start(&pace, TRUE, FALSE);
+    ch = Channel(&pace);
+    HOST_CHECK(DMAPACE_Loop(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 5000, Lli, 2) == SUCCESS);
+    /* The last item links back to the first one, nothing interrupts */
+    HOST_CHECK(Lli[0].NextLLI == (uint32_t)&Lli[1]);
+    HOST_CHECK(Lli[1].NextLLI == (uint32_t)&Lli[0]);
+    HOST_CHECK(!(Lli[0].Control & GPDMA_DMACCxControl_I));
+    HOST_CHECK(!(Lli[1].Control & GPDMA_DMACCxControl_I));
+    HOST_CHECK(ch->DMACCLLI == (uint32_t)&Lli[1]);
+
+    DMAPACE_Abort(&pace);
+    HOST_CHECK(!DMAPACE_IsBusy(&pace));
+    HOST_CHECK(!(ch->DMACCConfig & (GPDMA_DMACCxConfig_E | GPDMA_DMACCxConfig_H)));
+    HOST_CHECK(LPC_TIM1->TCR == 0);
+
+    /* A single chunk loops on itself */
+    HOST_CHECK(DMAPACE_Loop(&pace, (void*)DST_ADDR, (void*)SRC_ADDR, 64, Lli, 1) == SUCCESS);
+    HOST_CHECK(Lli[0].NextLLI == (uint32_t)&Lli[0]);
+    HOST_CHECK(ch->DMACCLLI == (uint32_t)&Lli[0]);
+    DMAPACE_Abort(&pace);
+    HOST_CHECK(Ends == 0);
+}
+
+static void Test_Pattern(void)
+{
+    DMAPAT_CFG_Type cfg = {LPC_TIM0, 0, 2, DMAPAT_TARGET_SET, GPDMA_WIDTH_BYTE, 1, 4000000, GPDMA_PRIO_HIGH};
+    DMAPAT_Type pat;
+    LPC_GPDMACH_TypeDef* ch;
+
+    Reset();
+    HOST_CHECK(DMAPAT_Init(&pat, &cfg) == SUCCESS);
+    ch = Channel(&pat.Pace);
+    HOST_CHECK(pat.DstAddr == (uint32_t)&LPC_GPIO2->FIOSET + 1);
+    HOST_CHECK(LPC_TIM0->MR0 == 24);
+    HOST_CHECK(LPC_SC->DMAREQSEL == (1 << 0));
+
+    /* Words from the buffer to the fixed port register, repeated */
+    HOST_CHECK(DMAPAT_Play(&pat, (void*)SRC_ADDR, 64, Lli, DMAPAT_LLI_COUNT(64), TRUE) == SUCCESS);
+    HOST_CHECK(ch->DMACCSrcAddr == SRC_ADDR);
+    HOST_CHECK(ch->DMACCDestAddr == pat.DstAddr);
+    HOST_CHECK(ch->DMACCLLI == (uint32_t)&Lli[0]);
+    HOST_CHECK((ch->DMACCControl & (GPDMA_DMACCxControl_SI | GPDMA_DMACCxControl_DI)) == GPDMA_DMACCxControl_SI);
+    HOST_CHECK(DMAPAT_IsBusy(&pat));
+    HOST_CHECK(DMAPAT_Play(&pat, (void*)SRC_ADDR, 64, Lli, 1, FALSE) == ERROR);
+    DMAPAT_Stop(&pat);
+    HOST_CHECK(!DMAPAT_IsBusy(&pat));
+
+    /* Played once, it ends on the terminal count */
+    HOST_CHECK(DMAPAT_Play(&pat, (void*)SRC_ADDR, 64, Lli, 1, FALSE) == SUCCESS);
+    HOST_CHECK(Lli[0].NextLLI == 0);
+    Model_TC(&pat.Pace);
+    HOST_CHECK(!DMAPAT_IsBusy(&pat));
+
+    DMAPAT_DeInit(&pat);
+    HOST_CHECK(GPDMA_ChAlloc == 0);
+}
+
+int main(void)
+{
+    HOST_Init();
+
+    Test_Init();
+    Test_Chunks();
+    Test_Single();
+    Test_Loop();
+    Test_Pattern();
+
+    return HOST_Report("test_dmapace");
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,383 @@
+/**********************************************************************
+ * $Id$		test_flashkv.c				2026-10-18
+ *//**
+* @file		test_flashkv.c
+* @brief	Host test of FLASHKV against a model of the IAP flash
+* 			commands
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include <string.h>
+#include "../src/lpc17xx_iap.c"
+#include "../src/lpc17xx_flashkv.c"
+
+/* Flash model ---------------------------------------------------------------- */
+/* The IAP entry point is replaced by a model of the ROM commands, working on
+ * the host-backed sectors 16..29:
+ * - a write or erase needs a prepare of its sectors first, consumed by it,
+ * - a write is 256, 512, 1024 or 4096 bytes to a 256 byte boundary,
+ * - a write may only go to erased bytes (ECC: a flash line is written once),
+ * - an erase sets whole sectors to 0xFF. */
+
+#define MODEL_FIRST_SECTOR (16)
+#define MODEL_LAST_SECTOR (29)
+
+typedef enum
+{
+    MODEL_FAIL_NONE = 0,
+    MODEL_FAIL_BLANK, /**< Write refused, nothing programmed */
+    MODEL_FAIL_TORN   /**< Write cut after its first half */
+} MODEL_FAIL_Type;
+
+static uint8_t Model_Prepared[MODEL_LAST_SECTOR + 1];
+static uint32_t Model_Erases[MODEL_LAST_SECTOR + 1];
+static uint32_t Model_Writes;
+/** Writes to bytes that were not erased */
+static uint32_t Model_Violations;
+/** Fail the write after this many more successful ones */
+static int32_t Model_FailIn = -1;
+static MODEL_FAIL_Type Model_FailMode;
+
+static uint32_t Model_SectorAddr(uint32_t sec)
+{
+    return 0x00010000 + ((sec - 16) << 15);
+}
+
+static Bool Model_RangePrepared(uint32_t first, uint32_t last)
+{
+    uint32_t sec;
+
+    for (sec = first; sec <= last; sec++)
+    {
+        if (!Model_Prepared[sec])
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void Model_Unprepare(void)
+{
+    memset(Model_Prepared, 0, sizeof(Model_Prepared));
+}
+
+static IAP_STATUS_CODE Model_Copy(uint32_t dst, const uint8_t* src, uint32_t count)
+{
+    uint8_t* flash = (uint8_t*)(uintptr_t)dst;
+    Bool torn = FALSE;
+    uint32_t i;
+
+    if (dst & 0xFF)
+    {
+        return DST_ADDR_ERROR;
+    }
+    if ((uintptr_t)src & 3)
+    {
+        return SRC_ADDR_ERROR;
+    }
+    if ((count != 256) && (count != 512) && (count != 1024) && (count != 4096))
+    {
+        return COUNT_ERROR;
+    }
+    if ((dst < HOST_FLASH_BASE) || (dst + count > HOST_FLASH_END))
+    {
+        return DST_ADDR_NOT_MAPPED;
+    }
+    if (!Model_RangePrepared(GetSecNum(dst), GetSecNum(dst + count - 1)))
+    {
+        return SECTOR_NOT_PREPARED_FOR_WRITE_OPERATION;
+    }
+    Model_Unprepare();
+
+    if (Model_FailIn == 0)
+    {
+        Model_FailIn = -1;
+        if (Model_FailMode == MODEL_FAIL_BLANK)
+        {
+            return BUSY;
+        }
+        count /= 2;
+        torn = TRUE;
+    }
+    else if (Model_FailIn > 0)
+    {
+        Model_FailIn--;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (flash[i] != 0xFF)
+        {
+            Model_Violations++;
+        }
+        flash[i] &= src[i];
+    }
+    Model_Writes++;
+    return torn ? BUSY : CMD_SUCCESS;
+}
+
+static IAP_STATUS_CODE Model_Erase(uint32_t first, uint32_t last)
+{
+    uint32_t sec;
+
+    if ((first < MODEL_FIRST_SECTOR) || (last > MODEL_LAST_SECTOR) || (first > last))
+    {
+        return INVALID_SECTOR;
+    }
+    if (!Model_RangePrepared(first, last))
+    {
+        return SECTOR_NOT_PREPARED_FOR_WRITE_OPERATION;
+    }
+    Model_Unprepare();
+
+    for (sec = first; sec <= last; sec++)
+    {
+        memset((void*)(uintptr_t)Model_SectorAddr(sec), 0xFF, 0x8000);
+        Model_Erases[sec]++;
+    }
+    return CMD_SUCCESS;
+}
+
+static void Model_Iap(uint32_t* cmd, uint32_t* result)
+{
+    IAP_STATUS_CODE status;
+
+    switch (cmd[0])
+    {
+    case IAP_PREPARE:
+        if ((cmd[1] < MODEL_FIRST_SECTOR) || (cmd[2] > MODEL_LAST_SECTOR) || (cmd[1] > cmd[2]))
+        {
+            status = INVALID_SECTOR;
+            break;
+        }
+        memset(&Model_Prepared[cmd[1]], 1, cmd[2] - cmd[1] + 1);
+        status = CMD_SUCCESS;
+        break;
+    case IAP_COPY_RAM2FLASH:
+        status = Model_Copy(cmd[1], (const uint8_t*)(uintptr_t)cmd[2], cmd[3]);
+        break;
+    case IAP_ERASE:
+        status = Model_Erase(cmd[1], cmd[2]);
+        break;
+    default:
+        status = INVALID_COMMAND;
+        break;
+    }
+    result[0] = status;
+}
+
+/** Erase the whole model, as a new part */
+static void Model_Reset(void)
+{
+    memset((void*)HOST_FLASH_BASE, 0xFF, HOST_FLASH_END - HOST_FLASH_BASE);
+    memset(Model_Erases, 0, sizeof(Model_Erases));
+    Model_Unprepare();
+    Model_Violations = 0;
+    Model_FailIn = -1;
+    Model_FailMode = MODEL_FAIL_NONE;
+}
+
+/* Tests ---------------------------------------------------------------------- */
+static const FLASHKV_CFG_Type Cfg = {16, 3};
+
+/** Check that a key holds a 4 byte value */
+static Bool HasValue(uint16_t key, uint32_t expected)
+{
+    uint32_t value = 0;
+    uint8_t length = 0;
+
+    if (FLASHKV_Get(key, &value, &length) != SUCCESS)
+    {
+        return FALSE;
+    }
+    return (length == 4) && (value == expected);
+}
+
+static void Test_RoundTrip(void)
+{
+    uint32_t v;
+    uint16_t key;
+
+    Model_Reset();
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    HOST_CHECK(FLASHKV_GetGeneration() == 1);
+    HOST_CHECK(FLASHKV_GetPtr(3, NULL) == NULL);
+
+    for (key = 0; key < 20; key++)
+    {
+        v = 1000 + key;
+        HOST_CHECK(FLASHKV_Set(key, &v, 4) == SUCCESS);
+    }
+    HOST_CHECK(HasValue(7, 1007));
+    HOST_CHECK(FLASHKV_Delete(5) == SUCCESS);
+    HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+
+    /* Reboot */
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    HOST_CHECK(HasValue(0, 1000));
+    HOST_CHECK(HasValue(19, 1019));
+    HOST_CHECK(FLASHKV_GetPtr(5, NULL) == NULL);
+    HOST_CHECK(Model_Violations == 0);
+}
+
+static void Test_WearLeveling(void)
+{
+    uint32_t i, v, min, max, sec;
+
+    Model_Reset();
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+
+    /* 127 record pages per sector: this wraps the ring several times */
+    for (i = 0; i < 3000; i++)
+    {
+        v = i;
+        HOST_CHECK(FLASHKV_Set(i % 4, &v, 4) == SUCCESS);
+        HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+    }
+    HOST_CHECK(FLASHKV_GetGeneration() > 3 * 3);
+    HOST_CHECK(HasValue(3, 2999));
+
+    min = max = Model_Erases[16];
+    for (sec = 16; sec < 16 + Cfg.NumSectors; sec++)
+    {
+        min = (Model_Erases[sec] < min) ? Model_Erases[sec] : min;
+        max = (Model_Erases[sec] > max) ? Model_Erases[sec] : max;
+    }
+    HOST_CHECK(max - min <= 1);
+
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    HOST_CHECK(HasValue(0, 2996));
+    HOST_CHECK(HasValue(3, 2999));
+    HOST_CHECK(Model_Violations == 0);
+}
+
+static void Test_TornWrite(void)
+{
+    uint32_t v = 0x12345678;
+    uint32_t page;
+
+    Model_Reset();
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    page = FLASHKV_NextPage;
+
+    /* The write is cut: the page is skipped and the next one takes it */
+    HOST_CHECK(FLASHKV_Set(1, &v, 4) == SUCCESS);
+    Model_FailMode = MODEL_FAIL_TORN;
+    Model_FailIn = 0;
+    HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+    HOST_CHECK(FLASHKV_NextPage == page + 2 * FLASHKV_PAGE_SIZE);
+    HOST_CHECK(HasValue(1, 0x12345678));
+
+    v = 0x9ABCDEF0;
+    HOST_CHECK(FLASHKV_Set(1, &v, 4) == SUCCESS);
+    HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    HOST_CHECK(HasValue(1, 0x9ABCDEF0));
+    HOST_CHECK(FLASHKV_NextPage == page + 3 * FLASHKV_PAGE_SIZE);
+    HOST_CHECK(Model_Violations == 0);
+}
+
+static void Test_RefusedWrite(void)
+{
+    uint32_t v = 42;
+    uint32_t page;
+
+    Model_Reset();
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    page = FLASHKV_NextPage;
+
+    /* Nothing was written: the page stays next, the records stay staged */
+    HOST_CHECK(FLASHKV_Set(2, &v, 4) == SUCCESS);
+    Model_FailMode = MODEL_FAIL_BLANK;
+    Model_FailIn = 0;
+    HOST_CHECK(FLASHKV_Commit() == ERROR);
+    HOST_CHECK(FLASHKV_NextPage == page);
+    HOST_CHECK(HasValue(2, 42));
+
+    Model_FailMode = MODEL_FAIL_NONE;
+    HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    HOST_CHECK(HasValue(2, 42));
+    HOST_CHECK(Model_Violations == 0);
+}
+
+static void Test_TornLastPage(void)
+{
+    uint32_t i, v, gen;
+
+    Model_Reset();
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    gen = FLASHKV_GetGeneration();
+
+    /* Fill the active sector up to its last page */
+    for (i = 0; i < 126; i++)
+    {
+        v = i;
+        HOST_CHECK(FLASHKV_Set(0, &v, 4) == SUCCESS);
+        HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+    }
+    HOST_CHECK(FLASHKV_GetGeneration() == gen);
+
+    /* A torn last page leaves the sector full: compact instead */
+    v = 7777;
+    HOST_CHECK(FLASHKV_Set(9, &v, 4) == SUCCESS);
+    Model_FailMode = MODEL_FAIL_TORN;
+    Model_FailIn = 0;
+    HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+    HOST_CHECK(FLASHKV_GetGeneration() == gen + 1);
+    HOST_CHECK(HasValue(9, 7777));
+    HOST_CHECK(HasValue(0, 125));
+
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    HOST_CHECK(HasValue(9, 7777));
+    HOST_CHECK(HasValue(0, 125));
+    HOST_CHECK(Model_Violations == 0);
+}
+
+static void Test_InterruptedCompaction(void)
+{
+    uint32_t i, v, gen;
+
+    Model_Reset();
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    for (i = 0; i < 127; i++)
+    {
+        v = i;
+        HOST_CHECK(FLASHKV_Set(i % 10, &v, 4) == SUCCESS);
+        HOST_CHECK(FLASHKV_Commit() == SUCCESS);
+    }
+    gen = FLASHKV_GetGeneration();
+
+    /* The header write of the compaction fails: the old sector stays */
+    v = 5555;
+    HOST_CHECK(FLASHKV_Set(11, &v, 4) == SUCCESS);
+    Model_FailMode = MODEL_FAIL_BLANK;
+    Model_FailIn = 2;
+    HOST_CHECK(FLASHKV_Commit() == ERROR);
+
+    HOST_CHECK(FLASHKV_Init(&Cfg) == SUCCESS);
+    HOST_CHECK(FLASHKV_GetGeneration() == gen);
+    HOST_CHECK(HasValue(6, 126));
+    HOST_CHECK(FLASHKV_GetPtr(11, NULL) == NULL);
+    HOST_CHECK(Model_Violations == 0);
+}
+
+int main(void)
+{
+    HOST_Init();
+    iap_entry = Model_Iap;
+
+    Test_RoundTrip();
+    Test_WearLeveling();
+    Test_TornWrite();
+    Test_RefusedWrite();
+    Test_TornLastPage();
+    Test_InterruptedCompaction();
+
+    return HOST_Report("test_flashkv");
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,184 @@
+/**********************************************************************
+ * $Id$		test_gpdma.c				2026-10-18
+ *//**
+* @file		test_gpdma.c
+* @brief	Host register-trace test of GPDMA_Compile()/GPDMA_Arm()
+* 			against GPDMA_Setup() + GPDMA_ChannelCmd()
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include <string.h>
+#include "../src/lpc17xx_clkpwr.c"
+#include "../src/lpc17xx_gpdma.c"
+
+/* Arm is Setup + ChannelCmd(ENABLE) minus the work done once at
+ * initialization: both leave the channel registers the same, but Arm
+ * - writes DMACCConfig once, with DMACCxConfig_E set, where Setup clears
+ *   Control and Config first and ChannelCmd sets E afterwards,
+ * - clears the channel TC and error flags, as Setup does,
+ * - does not write DMACConfig nor wait for it,
+ * - does not claim DMAREQSEL, the caller does it once with
+ *   GPDMA_ReqSelClaim(). */
+
+#define CH (3)
+
+static HOST_TRACE_Type SetupTrace[HOST_TRACE_MAX];
+static uint32_t SetupCount;
+
+/** AHB SRAM source and destination of the memory transfers */
+#define SRC_ADDR (0x2007C000UL)
+#define DST_ADDR (0x2007C400UL)
+
+static void Reset(void)
+{
+    memset((void*)LPC_GPDMA_BASE, 0, 0x200);
+    LPC_SC->DMAREQSEL = 0;
+    GPDMA_Init();
+}
+
+static void TraceBegin(void)
+{
+    const uint32_t pages[2] = {LPC_GPDMA_BASE, (uint32_t)&LPC_SC->DMAREQSEL};
+
+    HOST_TraceStart(pages, 2);
+}
+
+/** Check one traced store */
+static Bool Store(const HOST_TRACE_Type* t, volatile uint32_t* reg, uint32_t value)
+{
+    return (t->Addr == (uint32_t)(uintptr_t)reg) && (t->Value == value);
+}
+
+static void Compare(const char* name, GPDMA_Channel_CFG_Type* cfg, uint32_t muxConn)
+{
+    LPC_GPDMACH_TypeDef* ch = (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + CH * 0x20);
+    GPDMA_PROGRAM_Type prog;
+    uint32_t regs[5];
+    uint32_t i = 0;
+
+    printf("  %s\n", name);
+    cfg->ChannelNum = CH;
+
+    /* GPDMA_Setup() + GPDMA_ChannelCmd() */
+    Reset();
+    TraceBegin();
+    HOST_CHECK(GPDMA_Setup(cfg) == SUCCESS);
+    GPDMA_ChannelCmd(CH, ENABLE);
+    HOST_TraceStop();
+    SetupCount = HOST_TraceCount;
+    memcpy(SetupTrace, HOST_Trace, sizeof(HOST_Trace));
+    regs[0] = ch->DMACCSrcAddr;
+    regs[1] = ch->DMACCDestAddr;
+    regs[2] = ch->DMACCLLI;
+    regs[3] = ch->DMACCControl;
+    regs[4] = ch->DMACCConfig;
+    HOST_CHECK(regs[4] & GPDMA_DMACCxConfig_E);
+
+    HOST_CHECK(Store(&SetupTrace[i++], &LPC_GPDMA->DMACIntTCClear, 1 << CH));
+    HOST_CHECK(Store(&SetupTrace[i++], &LPC_GPDMA->DMACIntErrClr, 1 << CH));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCControl, 0));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCConfig, 0));
+    if (muxConn >= GPDMA_CONN_UART0_Tx)
+    {
+        HOST_CHECK(Store(&SetupTrace[i++], &LPC_SC->DMAREQSEL, (muxConn > GPDMA_CONN_UART3_Rx) << (muxConn & 7)));
+    }
+    HOST_CHECK(Store(&SetupTrace[i++], &LPC_GPDMA->DMACConfig, GPDMA_DMACConfig_E));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCLLI, regs[2]));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCSrcAddr, regs[0]));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCDestAddr, regs[1]));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCControl, regs[3]));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCConfig, regs[4] & ~GPDMA_DMACCxConfig_E));
+    HOST_CHECK(Store(&SetupTrace[i++], &ch->DMACCConfig, regs[4]));
+    HOST_CHECK(SetupCount == i);
+
+    /* GPDMA_Compile() and the claim once, GPDMA_Arm() per transfer */
+    Reset();
+    HOST_CHECK(GPDMA_Compile(cfg, &prog) == SUCCESS);
+    if (muxConn >= GPDMA_CONN_UART0_Tx)
+    {
+        HOST_CHECK(GPDMA_ReqSelClaim(CH, muxConn) == SUCCESS);
+    }
+    TraceBegin();
+    GPDMA_Arm(CH, &prog);
+    HOST_TraceStop();
+
+    i = 0;
+    HOST_CHECK(Store(&HOST_Trace[i++], &LPC_GPDMA->DMACIntTCClear, 1 << CH));
+    HOST_CHECK(Store(&HOST_Trace[i++], &LPC_GPDMA->DMACIntErrClr, 1 << CH));
+    HOST_CHECK(Store(&HOST_Trace[i++], &ch->DMACCSrcAddr, regs[0]));
+    HOST_CHECK(Store(&HOST_Trace[i++], &ch->DMACCDestAddr, regs[1]));
+    HOST_CHECK(Store(&HOST_Trace[i++], &ch->DMACCLLI, regs[2]));
+    HOST_CHECK(Store(&HOST_Trace[i++], &ch->DMACCControl, regs[3]));
+    HOST_CHECK(Store(&HOST_Trace[i++], &ch->DMACCConfig, regs[4]));
+    HOST_CHECK(HOST_TraceCount == i);
+
+    /* Same end state, request routing included */
+    HOST_CHECK(ch->DMACCSrcAddr == regs[0]);
+    HOST_CHECK(ch->DMACCDestAddr == regs[1]);
+    HOST_CHECK(ch->DMACCLLI == regs[2]);
+    HOST_CHECK(ch->DMACCControl == regs[3]);
+    HOST_CHECK(ch->DMACCConfig == regs[4]);
+    if (muxConn >= GPDMA_CONN_UART0_Tx)
+    {
+        HOST_CHECK(((LPC_SC->DMAREQSEL >> (muxConn & 7)) & 1) == (muxConn > GPDMA_CONN_UART3_Rx));
+    }
+}
+
+int main(void)
+{
+    static GPDMA_LLI_Type lli;
+    GPDMA_Channel_CFG_Type cfg;
+    const uint32_t probe = LPC_GPDMA_BASE;
+
+    HOST_Init();
+    if (!HOST_TraceStart(&probe, 1))
+    {
+        printf("test_gpdma: register trace not supported on this host, skipped\n");
+        return 0;
+    }
+    HOST_TraceStop();
+
+    printf("test_gpdma: register traces\n");
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.TransferType = GPDMA_TRANSFERTYPE_M2M;
+    cfg.TransferSize = 64;
+    cfg.TransferWidth = GPDMA_WIDTH_WORD;
+    cfg.SrcMemAddr = SRC_ADDR;
+    cfg.DstMemAddr = DST_ADDR;
+    Compare("M2M", &cfg, 0);
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    cfg.TransferSize = 32;
+    cfg.SrcMemAddr = SRC_ADDR;
+    cfg.DstConn = GPDMA_CONN_DAC;
+    cfg.DMALLI = (uint32_t)(uintptr_t)&lli;
+    Compare("M2P DAC, linked", &cfg, GPDMA_CONN_DAC);
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.TransferType = GPDMA_TRANSFERTYPE_P2M;
+    cfg.TransferSize = 16;
+    cfg.SrcConn = GPDMA_CONN_ADC;
+    cfg.DstMemAddr = DST_ADDR;
+    Compare("P2M ADC", &cfg, GPDMA_CONN_ADC);
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    cfg.TransferSize = 8;
+    cfg.SrcMemAddr = SRC_ADDR;
+    cfg.DstConn = GPDMA_CONN_MAT1_0;
+    Compare("M2P MAT1.0 (DMAREQSEL)", &cfg, GPDMA_CONN_MAT1_0);
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.TransferType = GPDMA_TRANSFERTYPE_P2M;
+    cfg.TransferSize = 8;
+    cfg.SrcConn = GPDMA_CONN_UART1_Rx;
+    cfg.DstMemAddr = DST_ADDR;
+    Compare("P2M UART1 Rx (DMAREQSEL)", &cfg, GPDMA_CONN_UART1_Rx);
+
+    return HOST_Report("test_gpdma");
+}
+
+/* --------------------------------- End Of File ------------------------------ */
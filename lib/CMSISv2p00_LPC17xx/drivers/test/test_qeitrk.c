@@ -0,0 +1,179 @@
+/**********************************************************************
+ * $Id$		test_qeitrk.c				2026-10-18
+ *//**
+* @file		test_qeitrk.c
+* @brief	Host test of QEITRK driven by an encoder stimulus model
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "../src/lpc17xx_clkpwr.c"
+#include "../src/lpc17xx_qei.c"
+#include "../src/lpc17xx_qeitrk.c"
+
+/* Encoder model -------------------------------------------------------------- */
+/* A shaft turning at a given speed, seen through the QEI: every velocity
+ * timer period the edges counted are added to QEIPOS (wrapping at 32 bits),
+ * latched in QEICAP, and the timer interrupt is raised and serviced. */
+
+#define PPR (500)
+#define PERIOD_US (1000)
+
+/** Read-only registers are written by the model */
+#define MODEL_REG(reg) (*(volatile uint32_t*)&(reg))
+
+/** Edges not yet counted, fraction of an edge */
+static double Model_Frac;
+/** Edges of the whole run, unwrapped */
+static int64_t Model_Edges;
+
+static uint32_t Model_EdgesPerRev(void)
+{
+    return PPR * ((LPC_QEI->QEICONF & QEI_CONF_CAPMODE) ? 4 : 2);
+}
+
+/** One velocity period at rpm, then the interrupt */
+static void Model_Period(double rpm)
+{
+    int32_t edges;
+
+    Model_Frac += rpm / 60.0 * Model_EdgesPerRev() * (PERIOD_US / 1e6);
+    edges = (int32_t)Model_Frac;
+    Model_Frac -= edges;
+    Model_Edges += edges;
+
+    MODEL_REG(LPC_QEI->QEIPOS) = LPC_QEI->QEIPOS + (uint32_t)edges;
+    MODEL_REG(LPC_QEI->QEICAP) = (uint32_t)((edges < 0) ? -edges : edges);
+    MODEL_REG(LPC_QEI->QEIINTSTAT) = QEI_INTSTAT_TIM_Int;
+    QEITRK_IRQHandler();
+}
+
+static void Model_Start(uint32_t pos, uint32_t capmode4x)
+{
+    static const QEITRK_CFG_Type cfg = {PPR, PERIOD_US, 13107, 1311}; /* 0.2, 0.02 */
+
+    LPC_QEI->QEICONF = capmode4x ? QEI_CONF_CAPMODE : 0;
+    MODEL_REG(LPC_QEI->QEIPOS) = pos;
+    Model_Frac = 0;
+    Model_Edges = 0;
+    QEITRK_Init(&cfg);
+}
+
+static double Rpm(int32_t fixed)
+{
+    return fixed / (double)(1 << QEITRK_RPM_FRAC_BITS);
+}
+
+/* Tests ---------------------------------------------------------------------- */
+static void Test_Scale(void)
+{
+    /* 25 MHz PCLK (CCLK / 4) and 1 ms give a load of 25000 */
+    Model_Start(0, 1);
+    HOST_CHECK(LPC_QEI->QEILOAD == 25000 - 1);
+    HOST_CHECK(LPC_QEI->QEIMAXPOS == 0xFFFFFFFF);
+}
+
+static void Test_ConstantSpeed(void)
+{
+    uint32_t i;
+
+    Model_Start(0, 1);
+    for (i = 0; i < 2000; i++)
+    {
+        Model_Period(1500.0);
+    }
+    HOST_CHECK(QEITRK_GetUpdates() == 2000);
+    HOST_CHECK(fabs(Rpm(QEITRK_GetRpm()) - 1500.0) < 1500.0 * 0.001);
+    /* 1500 RPM is 50 edges per period exactly */
+    HOST_CHECK(Rpm(QEITRK_GetRawRpm()) == 1500.0);
+    HOST_CHECK(QEITRK_GetRawRpm() >> QEITRK_RPM_FRAC_BITS == (int32_t)QEI_CalculateRPM(LPC_QEI, 50, PPR));
+    HOST_CHECK(labs(QEITRK_GetPosition() - (int32_t)Model_Edges) <= 1);
+
+    /* A speed that is not a whole number of edges per period */
+    for (i = 0; i < 2000; i++)
+    {
+        Model_Period(1234.5);
+    }
+    HOST_CHECK(fabs(Rpm(QEITRK_GetRpm()) - 1234.5) < 1234.5 * 0.001);
+}
+
+static void Test_Reversal(void)
+{
+    uint32_t i;
+
+    Model_Start(1000, 0);
+    for (i = 0; i < 1000; i++)
+    {
+        Model_Period(900.0);
+    }
+    HOST_CHECK(fabs(Rpm(QEITRK_GetRpm()) - 900.0) < 900.0 * 0.001);
+
+    for (i = 0; i < 2000; i++)
+    {
+        Model_Period(-600.0);
+    }
+    HOST_CHECK(fabs(Rpm(QEITRK_GetRpm()) + 600.0) < 600.0 * 0.001);
+    HOST_CHECK(QEITRK_GetRawRpm() < 0);
+    HOST_CHECK(labs(QEITRK_GetPosition() - (int32_t)Model_Edges) <= 1);
+}
+
+static void Test_CounterWrap(void)
+{
+    uint32_t i;
+
+    /* 3000 RPM, 100 edges per period, wraps QEIPOS after 10 periods */
+    Model_Start(0xFFFFFC00, 1);
+    for (i = 0; i < 3000; i++)
+    {
+        Model_Period(3000.0);
+    }
+    HOST_CHECK(LPC_QEI->QEIPOS < 0xFFFFFC00);
+    HOST_CHECK(fabs(Rpm(QEITRK_GetRpm()) - 3000.0) < 3000.0 * 0.001);
+    HOST_CHECK(labs(QEITRK_GetPosition() - (int32_t)Model_Edges) <= 1);
+}
+
+static void Test_Ramp(void)
+{
+    double rpm = 0;
+    uint32_t i;
+
+    /* 1000 RPM/s: an alpha-beta filter lags a ramp by a constant */
+    Model_Start(0, 1);
+    for (i = 0; i < 3000; i++)
+    {
+        rpm += 1.0;
+        Model_Period(rpm);
+    }
+    HOST_CHECK(fabs(Rpm(QEITRK_GetRpm()) - rpm) < rpm * 0.01);
+}
+
+static void Test_Spurious(void)
+{
+    uint32_t updates;
+
+    /* Another QEI interrupt source: no update */
+    Model_Start(0, 1);
+    Model_Period(100.0);
+    updates = QEITRK_GetUpdates();
+    MODEL_REG(LPC_QEI->QEIINTSTAT) = QEI_INTSTAT_INX_Int;
+    QEITRK_IRQHandler();
+    HOST_CHECK(QEITRK_GetUpdates() == updates);
+}
+
+int main(void)
+{
+    HOST_Init();
+
+    Test_Scale();
+    Test_ConstantSpeed();
+    Test_Reversal();
+    Test_CounterWrap();
+    Test_Ramp();
+    Test_Spurious();
+
+    return HOST_Report("test_qeitrk");
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,148 @@
+/**********************************************************************
+ * $Id$		test_ringbuf.c				2026-10-18
+ *//**
+* @file		test_ringbuf.c
+* @brief	Host test of the RINGBUF containers against brute force
+* 			references
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include <stdlib.h>
+#include "lpc17xx_ringbuf.h"
+
+RINGBUF_DECLARE(Queue, uint16_t, 8)
+MAVG_DECLARE(Hist, uint16_t, uint32_t, 32)
+WINMINMAX_DECLARE(Win, int16_t, 16)
+
+static void Test_Queue(void)
+{
+    static Queue_Type q;
+    uint16_t v = 0;
+    uint32_t i;
+
+    Queue_Init(&q);
+    HOST_CHECK(Queue_Count(&q) == 0);
+    HOST_CHECK(Queue_Get(&q, &v) == ERROR);
+
+    for (i = 0; i < 8; i++)
+    {
+        HOST_CHECK(Queue_Put(&q, (uint16_t)(100 + i)) == SUCCESS);
+    }
+    HOST_CHECK(Queue_IsFull(&q) == TRUE);
+    HOST_CHECK(Queue_Put(&q, 999) == ERROR);
+    HOST_CHECK(Queue_Peek(&q, 0) == 100);
+    HOST_CHECK(Queue_Peek(&q, 7) == 107);
+
+    for (i = 0; i < 8; i++)
+    {
+        HOST_CHECK(Queue_Get(&q, &v) == SUCCESS);
+        HOST_CHECK(v == 100 + i);
+    }
+    HOST_CHECK(Queue_Get(&q, &v) == ERROR);
+
+    /* Free-running indices across the 32 bit wrap */
+    q.Head = q.Tail = 0xFFFFFFFC;
+    for (i = 0; i < 8; i++)
+    {
+        HOST_CHECK(Queue_Put(&q, (uint16_t)i) == SUCCESS);
+    }
+    HOST_CHECK(Queue_Count(&q) == 8);
+    HOST_CHECK(Queue_Put(&q, 8) == ERROR);
+    for (i = 0; i < 8; i++)
+    {
+        HOST_CHECK((Queue_Get(&q, &v) == SUCCESS) && (v == i));
+    }
+    HOST_CHECK(Queue_Count(&q) == 0);
+}
+
+static void Test_MovingAverage(void)
+{
+    static Hist_Type h;
+    static uint16_t ref[1000];
+    uint32_t i, j, n, sum;
+
+    Hist_Init(&h);
+    HOST_CHECK(Hist_Average(&h) == 0);
+
+    srand(1);
+    for (i = 0; i < 1000; i++)
+    {
+        ref[i] = (uint16_t)(rand() & 0xFFF);
+        Hist_Push(&h, ref[i]);
+
+        n = (i + 1 < 32) ? i + 1 : 32;
+        sum = 0;
+        for (j = 0; j < n; j++)
+        {
+            sum += ref[i - j];
+        }
+        HOST_CHECK(Hist_Count(&h) == n);
+        HOST_CHECK(Hist_Sum(&h) == sum);
+        HOST_CHECK(Hist_Average(&h) == sum / n);
+        HOST_CHECK(Hist_Last(&h, 0) == ref[i]);
+        HOST_CHECK(Hist_Last(&h, n - 1) == ref[i - (n - 1)]);
+    }
+}
+
+static void Test_WindowMinMax(void)
+{
+    static Win_Type w;
+    static int16_t ref[2000];
+    int16_t min, max;
+    uint32_t i, j, n;
+
+    Win_Init(&w);
+    srand(2);
+    for (i = 0; i < 2000; i++)
+    {
+        /* Runs and plateaus exercise both deques */
+        ref[i] = (i % 200 < 100) ? (int16_t)((rand() % 64) - 32) : (int16_t)(i % 7);
+        Win_Push(&w, ref[i]);
+
+        n = (i + 1 < 16) ? i + 1 : 16;
+        min = max = ref[i];
+        for (j = 1; j < n; j++)
+        {
+            min = (ref[i - j] < min) ? ref[i - j] : min;
+            max = (ref[i - j] > max) ? ref[i - j] : max;
+        }
+        HOST_CHECK(Win_Min(&w) == min);
+        HOST_CHECK(Win_Max(&w) == max);
+    }
+}
+
+static void Test_Ema(void)
+{
+    EMA_Type ema;
+    uint32_t i;
+
+    EMA_Init(&ema, 4);
+    EMA_Push(&ema, 1000);
+    HOST_CHECK(EMA_Get(&ema) == 1000);
+
+    /* A step settles to within one count of the new level */
+    for (i = 0; i < 200; i++)
+    {
+        EMA_Push(&ema, -500);
+    }
+    HOST_CHECK((EMA_Get(&ema) >= -501) && (EMA_Get(&ema) <= -499));
+
+    /* One step of alpha = 1/16 */
+    EMA_Init(&ema, 4);
+    EMA_Push(&ema, 0);
+    EMA_Push(&ema, 1600);
+    HOST_CHECK(EMA_Get(&ema) == 100);
+}
+
+int main(void)
+{
+    Test_Queue();
+    Test_MovingAverage();
+    Test_WindowMinMax();
+    Test_Ema();
+
+    return HOST_Report("test_ringbuf");
+}
+
+/* --------------------------------- End Of File ------------------------------ */
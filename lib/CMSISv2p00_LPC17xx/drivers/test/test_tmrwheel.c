@@ -0,0 +1,274 @@
+/**********************************************************************
+ * $Id$		test_tmrwheel.c				2026-10-18
+ *//**
+* @file		test_tmrwheel.c
+* @brief	Host test of TMRWHEEL driven by a match timer model
+* @version	1.0
+* @date		18. Oct. 2026
+**********************************************************************/
+
+#include "../src/lpc17xx_clkpwr.c"
+#include "../src/lpc17xx_timer.c"
+#include "../src/lpc17xx_tmrwheel.c"
+
+/* Timer model ---------------------------------------------------------------- */
+/* TIMER0 counts only when the model moves it. Moving TC to a later value
+ * stops at the programmed match, if the match interrupt is enabled and the
+ * counter reaches it on the way, and runs the interrupt handler there, then
+ * the dispatcher: callbacks see the counter at the tick they expire on. As
+ * on the target, a match the counter is already at or past does not fire
+ * until the counter comes round again. */
+
+/** Ticks the counter moves on while the match register is written */
+static uint32_t Model_Slip;
+static uint32_t Model_Irqs;
+
+/** Move the counter to t, serving the match interrupts on the way */
+static void Model_RunTo(uint32_t t)
+{
+    uint32_t step;
+
+    for (;;)
+    {
+        step = LPC_TIM0->MR0 - LPC_TIM0->TC;
+        if ((LPC_TIM0->MCR & TIM_INT_ON_MATCH(0)) && (step != 0) && (step <= t - LPC_TIM0->TC))
+        {
+            LPC_TIM0->TC = LPC_TIM0->MR0;
+            TMRWHEEL_IRQHandler();
+            Model_Irqs++;
+            TMRWHEEL_Dispatch();
+        }
+        else
+        {
+            LPC_TIM0->TC = t;
+            TMRWHEEL_Dispatch();
+            return;
+        }
+    }
+}
+
+static void Model_Run(uint32_t ticks)
+{
+    Model_RunTo(LPC_TIM0->TC + ticks);
+}
+
+/** Store hook: the counter moves on while MR0 is written */
+static void Model_Store(uint32_t addr)
+{
+    if ((addr == (uint32_t)&LPC_TIM0->MR0) && Model_Slip)
+    {
+        LPC_TIM0->TC += Model_Slip;
+        Model_Slip = 0;
+    }
+}
+
+/** A timer and the counter values its callback ran at */
+typedef struct
+{
+    TMRWHEEL_Timer_Type Timer;
+    uint32_t Fired;
+    uint32_t At[16];
+} PROBE_Type;
+
+static void Probe_Callback(void* arg)
+{
+    PROBE_Type* p = (PROBE_Type*)arg;
+
+    if (p->Fired < 16)
+    {
+        p->At[p->Fired] = TMRWHEEL_Now();
+    }
+    p->Fired++;
+}
+
+static void Probe_Init(PROBE_Type* p)
+{
+    TMRWHEEL_TimerInit(&p->Timer, Probe_Callback, p);
+    p->Fired = 0;
+}
+
+static Bool WheelEmpty(void)
+{
+    uint32_t l;
+
+    for (l = 0; l < TMRWHEEL_LEVELS; l++)
+    {
+        if (TMRWHEEL_Occupied[l])
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Tests ---------------------------------------------------------------------- */
+/* Level l holds deadlines 32^l to 32^(l+1) slots of 128 ticks ahead */
+static const uint32_t Delays[TMRWHEEL_LEVELS] = {1000, 10000, 200000, 5000000, 1000000000};
+
+static void Test_Levels(void)
+{
+    PROBE_Type probes[TMRWHEEL_LEVELS];
+    uint32_t start, l;
+
+    /* Insert and cancel at each level */
+    for (l = 0; l < TMRWHEEL_LEVELS; l++)
+    {
+        Probe_Init(&probes[l]);
+        HOST_CHECK(TMRWHEEL_Start(&probes[l].Timer, Delays[l], 0) == SUCCESS);
+        HOST_CHECK(probes[l].Timer.Level == l);
+        HOST_CHECK(TMRWHEEL_Occupied[l] == (1UL << probes[l].Timer.Slot));
+    }
+    for (l = 0; l < TMRWHEEL_LEVELS; l++)
+    {
+        TMRWHEEL_Cancel(&probes[l].Timer);
+        HOST_CHECK(!TMRWHEEL_IsActive(&probes[l].Timer));
+        HOST_CHECK(TMRWHEEL_Occupied[l] == 0);
+    }
+    Model_Run(Delays[0] * 2);
+    HOST_CHECK(probes[0].Fired == 0);
+
+    /* Each fires once, on its tick, after cascading down the levels */
+    start = LPC_TIM0->TC;
+    for (l = 0; l < TMRWHEEL_LEVELS; l++)
+    {
+        HOST_CHECK(TMRWHEEL_Start(&probes[l].Timer, Delays[l], 0) == SUCCESS);
+    }
+    Model_Irqs = 0;
+    Model_RunTo(start + Delays[TMRWHEEL_LEVELS - 1] + 1);
+    for (l = 0; l < TMRWHEEL_LEVELS; l++)
+    {
+        HOST_CHECK(probes[l].Fired == 1);
+        HOST_CHECK(probes[l].At[0] == start + Delays[l]);
+        HOST_CHECK(!TMRWHEEL_IsActive(&probes[l].Timer));
+    }
+    /* A few cascade stops per level, not one per slot */
+    HOST_CHECK(Model_Irqs < TMRWHEEL_LEVELS * 2 * TMRWHEEL_SLOTS);
+    HOST_CHECK(WheelEmpty());
+}
+
+static void Test_Cascade(void)
+{
+    PROBE_Type probe;
+    uint32_t start;
+
+    /* Just before a level 1 boundary (4096 ticks), due 3 level 1 slots on */
+    Model_RunTo((LPC_TIM0->TC | 0xFFF) + 1 - 20);
+    start = LPC_TIM0->TC;
+    Probe_Init(&probe);
+    TMRWHEEL_Start(&probe.Timer, 3 * 4096 + 300, 0);
+    HOST_CHECK(probe.Timer.Level == 1);
+
+    /* Crossing the boundary is not a cascade of this slot yet */
+    Model_Run(40);
+    HOST_CHECK(probe.Timer.Level == 1);
+
+    /* The level 1 slot starts before the deadline and moves it to level 0 */
+    Model_RunTo(start + 3 * 4096 + 300 - 100);
+    HOST_CHECK(probe.Timer.Level == 0);
+    HOST_CHECK(probe.Fired == 0);
+    Model_RunTo(start + 3 * 4096 + 300 + 100);
+    HOST_CHECK(probe.Fired == 1);
+    HOST_CHECK(probe.At[0] == start + 3 * 4096 + 300);
+}
+
+static void Test_CounterWrap(void)
+{
+    PROBE_Type once, periodic;
+    uint32_t i;
+
+    /* The wheel is empty, the counter jumps close to the wrap */
+    LPC_TIM0->TC = 0xFFFFF000;
+    Probe_Init(&once);
+    Probe_Init(&periodic);
+    TMRWHEEL_Start(&once.Timer, 0x2000, 0);
+    TMRWHEEL_Start(&periodic.Timer, 0x700, 0x900);
+    Model_RunTo(0x5000);
+
+    HOST_CHECK(once.Fired == 1);
+    HOST_CHECK(once.At[0] == 0x1000);
+    HOST_CHECK(periodic.Fired == 10);
+    for (i = 0; i < 10; i++)
+    {
+        HOST_CHECK(periodic.At[i] == 0xFFFFF000 + 0x700 + i * 0x900);
+    }
+    TMRWHEEL_Cancel(&periodic.Timer);
+}
+
+static void Test_Periodic(void)
+{
+    PROBE_Type probe;
+    uint32_t start, i;
+
+    start = LPC_TIM0->TC;
+    Probe_Init(&probe);
+    TMRWHEEL_Start(&probe.Timer, 500, 1000);
+    Model_Run(500 + 9 * 1000);
+    /* Re-armed from the previous expiry, no drift */
+    HOST_CHECK(probe.Fired == 10);
+    for (i = 0; i < 10; i++)
+    {
+        HOST_CHECK(probe.At[i] == start + 500 + i * 1000);
+    }
+    HOST_CHECK(TMRWHEEL_IsActive(&probe.Timer));
+    HOST_CHECK(probe.Timer.Expires == start + 500 + 10 * 1000);
+
+    /* Expiries missed while the counter jumped run the callback once, and
+     * the period stays on its grid */
+    probe.Fired = 0;
+    TMRWHEEL_Adjust(3500);
+    TMRWHEEL_Dispatch();
+    HOST_CHECK(probe.Fired == 1);
+    HOST_CHECK(probe.Timer.Expires == start + 500 + 13 * 1000);
+
+    TMRWHEEL_Cancel(&probe.Timer);
+    HOST_CHECK(WheelEmpty());
+}
+
+static void Test_PassedMatch(void)
+{
+    const uint32_t page = (uint32_t)LPC_TIM0_BASE;
+    PROBE_Type probe;
+    uint32_t start;
+
+    /* The counter passes a close deadline while it is written to MR0: no
+     * interrupt would come before the counter wraps, Program() sees it and
+     * the wheel expires the timer at once */
+    HOST_StoreHook = Model_Store;
+    if (!HOST_TraceStart(&page, 1))
+    {
+        printf("  passed match: store tracing not supported, skipped\n");
+        HOST_StoreHook = NULL;
+        return;
+    }
+    start = LPC_TIM0->TC;
+    Probe_Init(&probe);
+    Model_Slip = 50;
+    TMRWHEEL_Start(&probe.Timer, 20, 0);
+    HOST_TraceStop();
+    HOST_StoreHook = NULL;
+
+    HOST_CHECK(Model_Slip == 0);
+    HOST_CHECK(LPC_TIM0->TC == start + 50);
+    HOST_CHECK(!TMRWHEEL_IsActive(&probe.Timer));
+    HOST_CHECK(!(LPC_TIM0->MCR & TIM_INT_ON_MATCH(0)));
+    HOST_CHECK(TMRWHEEL_Dispatch() == 1);
+    HOST_CHECK(probe.Fired == 1);
+}
+
+int main(void)
+{
+    static const TMRWHEEL_CFG_Type cfg = {LPC_TIM0, 0, 1};
+
+    HOST_Init();
+    TMRWHEEL_Init(&cfg);
+
+    Test_Levels();
+    Test_Cascade();
+    Test_CounterWrap();
+    Test_Periodic();
+    Test_PassedMatch();
+
+    return HOST_Report("test_tmrwheel");
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -51,6 +51,32 @@ extern uint32_t SystemCoreClock;     /*!< System Clock Frequency (Core Clock)  *
  */
 extern void SystemInit (void);
 
+/**
+ * Boot stages of SystemInit
+ *
+ * @param  none
+ * @return none
+ *
+ * @brief  SystemInit() split in three stages, so the reset handler can
+ *         overlap oscillator start-up and PLL lock with memory and
+ *         peripheral initialization. They must be called in order:
+ *         SystemInitStart(), SystemInitPLL(), SystemInitFinish().
+ */
+extern void SystemInitStart (void);
+extern void SystemInitPLL (void);
+extern void SystemInitFinish (void);
+
+/**
+ * Restore the clocks after Deep-sleep
+ *
+ * @param  none
+ * @return none
+ *
+ * @brief  Relocks and reconnects the PLLs stopped by Deep-sleep, keeping
+ *         the peripheral clock and power settings.
+ */
+extern void SystemResume (void);
+
 /**
  * Update SystemCoreClock variable
  *
@@ -26,6 +26,14 @@
 //
 //*****************************************************************************
 #include "LPC17xx.h"
+#ifdef __BOOT_PROFILE
+#include "lpc17xx_bootprof.h"
+#else
+#define BOOTPROF_MARK(name) ((void)0)
+#endif
+#ifdef __RAM_VECTORS
+#include "lpc17xx_ramfunc.h"
+#endif
 
 #define WEAK     __attribute__((weak))
 #define ALIAS(f) __attribute__((weak, alias(#f)))
@@ -104,6 +112,20 @@ extern WEAK void __libc_init_array(void);
 //
 //*****************************************************************************
 extern WEAK void main(void);
+
+//*****************************************************************************
+//
+// Boot stages of SystemInit, and the hook called while the PLLs lock.
+// SystemInitPeripherals() runs before the PLL is connected, so it should only
+// do clock independent setup (PINSEL, GPIO directions, PCONP...). The default
+// does nothing; the application overrides it by defining a function with the
+// same name.
+//
+//*****************************************************************************
+extern void SystemInitStart(void);
+extern void SystemInitPLL(void);
+extern void SystemInitFinish(void);
+void SystemInitPeripherals(void) ALIAS(EmptyHook);
 //*****************************************************************************
 //
 // External declaration for the pointer to the stack top from the Linker Script
@@ -194,33 +216,74 @@ extern unsigned long _ebss;
 //*****************************************************************************
 void Reset_Handler(void)
 {
-    unsigned long *pulSrc, *pulDest;
+#ifdef __BOOT_PROFILE
+    BOOTPROF_Start();
+#endif
+    //
+    // Start the main oscillator first, it stabilizes while memory is
+    // being initialized.
+    //
+    SystemInitStart();
 
     //
-    // Copy the data segment initializers from flash to SRAM.
+    // Copy the data segment initializers from flash to SRAM and zero fill
+    // the bss segment, 16 bytes per iteration with LDM/STM and a word loop
+    // for the tail. This is done with inline assembly so the pointers are
+    // kept in registers. The data segment also holds the SECTION_RAMFUNC
+    // code, so this copies it to SRAM too.
     //
-    pulSrc = &_etext;
-    for (pulDest = &_data; pulDest < &_edata;)
-    {
-        *pulDest++ = *pulSrc++;
-    }
+    __asm volatile("    ldr     r0, =_etext\n"
+                   "    ldr     r1, =_data\n"
+                   "    ldr     r2, =_edata\n"
+                   "1:  sub     r3, r2, r1\n"
+                   "    cmp     r3, #16\n"
+                   "    blt     2f\n"
+                   "    ldmia   r0!, {r3, r4, r5, r6}\n"
+                   "    stmia   r1!, {r3, r4, r5, r6}\n"
+                   "    b       1b\n"
+                   "2:  cmp     r1, r2\n"
+                   "    bge     3f\n"
+                   "    ldr     r3, [r0], #4\n"
+                   "    str     r3, [r1], #4\n"
+                   "    b       2b\n"
+                   "3:  ldr     r0, =_bss\n"
+                   "    ldr     r1, =_ebss\n"
+                   "    mov     r3, #0\n"
+                   "    mov     r4, #0\n"
+                   "    mov     r5, #0\n"
+                   "    mov     r6, #0\n"
+                   "4:  sub     r2, r1, r0\n"
+                   "    cmp     r2, #16\n"
+                   "    blt     5f\n"
+                   "    stmia   r0!, {r3, r4, r5, r6}\n"
+                   "    b       4b\n"
+                   "5:  cmp     r0, r1\n"
+                   "    it      lt\n"
+                   "    strlt   r3, [r0], #4\n"
+                   "    blt     5b\n"
+                   :
+                   :
+                   : "r0", "r1", "r2", "r3", "r4", "r5", "r6", "cc", "memory");
+    BOOTPROF_MARK("data/bss");
 
     //
-    // Zero fill the bss segment.  This is done with inline assembly since this
-    // will clear the value of pulDest if it is not kept in a register.
+    // Switch to the main oscillator and enable the PLLs, then do the
+    // application's clock independent peripheral setup while they lock.
     //
-    __asm("    ldr     r0, =_bss\n"
-          "    ldr     r1, =_ebss\n"
-          "    mov     r2, #0\n"
-          "    .thumb_func\n"
-          "zero_loop:\n"
-          "        cmp     r0, r1\n"
-          "        it      lt\n"
-          "        strlt   r2, [r0], #4\n"
-          "        blt     zero_loop");
+    SystemInitPLL();
+    BOOTPROF_MARK("pll enable");
+    SystemInitPeripherals();
+    BOOTPROF_MARK("peripherals");
+    SystemInitFinish();
+    BOOTPROF_MARK("pll lock");
 
-    // Call SystemInit to initialize clocks, etc.
-    SystemInit();
+#ifdef __RAM_VECTORS
+    //
+    // Run the exception vectors from SRAM, after SystemInitFinish() has set
+    // VTOR to the flash table
+    //
+    RAMFUNC_RelocateVectors();
+#endif
 
 #if defined(__cplusplus)
     //
@@ -300,6 +363,13 @@ static void DebugMon_Handler(void)
 static void PendSV_Handler(void) {}
 
 static void SysTick_Handler(void) {}
+//*****************************************************************************
+//
+// Default for optional boot hooks.
+//
+//*****************************************************************************
+static void EmptyHook(void) {}
+
 //*****************************************************************************
 //
 // Processor ends up here if an unexpected interrupt occurs or a handler
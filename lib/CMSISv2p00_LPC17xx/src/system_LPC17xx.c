@@ -485,28 +485,43 @@ void SystemCoreClockUpdate(void) /* Get Core Clock Frequency      */
 }
 
 /**
- * Initialize the system
+ * Start the main oscillator
  *
  * @param  none
  * @return none
  *
- * @brief  Setup the microcontroller system.
- *         Initialize the System.
+ * @brief  First boot stage. Only touches SC registers, so it can run from
+ *         the reset handler before .data/.bss are initialized, letting the
+ *         oscillator start up while memory is being set up.
  */
-void SystemInit(void)
+void SystemInitStart(void)
 {
-    const uint32_t PLL0_CONNECT_FLG = (1 << 25) | (1 << 24);
-    const uint32_t PLL1_CONNECT_FLG = (1 << 8) | (1 << 9);
-
 #if (CLOCK_SETUP) /* Clock Setup                        */
     LPC_SC->SCS = SCS_Val;
+#endif
+}
+
+/**
+ * Configure and enable the PLLs
+ *
+ * @param  none
+ * @return none
+ *
+ * @brief  Second boot stage. Waits for the main oscillator, switches the
+ *         CPU to it (faster than the 4 MHz IRC) and enables the PLLs
+ *         without waiting for lock, so that peripheral register setup can
+ *         overlap the lock time. Peripheral power (PCONP) is set here, so
+ *         that setup is not undone. SystemInitFinish() must follow.
+ */
+void SystemInitPLL(void)
+{
+#if (CLOCK_SETUP) /* Clock Setup                        */
     if (LPC_SC->SCS & (1 << 5))
     { /* If Main Oscillator is enabled  */
         while ((LPC_SC->SCS & (1 << 6)) == 0)
             ; /* Wait for Oscillator to be ready    */
     }
 
-    LPC_SC->CCLKCFG = CCLKCFG_Val; /* Setup Clock Divider                */
     /* Periphral clock must be selected before PLL0 enabling and connecting
      * - according errata.lpc1768-16.March.2010 -
      */
@@ -523,21 +538,123 @@ void SystemInit(void)
     LPC_SC->PLL0CON = 0x01; /* PLL0 Enable                        */
     LPC_SC->PLL0FEED = 0xAA;
     LPC_SC->PLL0FEED = 0x55;
+#endif
+
+#if (PLL1_SETUP)
+    LPC_SC->PLL1CFG = PLL1CFG_Val;
+    LPC_SC->PLL1FEED = 0xAA;
+    LPC_SC->PLL1FEED = 0x55;
+
+    LPC_SC->PLL1CON = 0x01; /* PLL1 Enable                        */
+    LPC_SC->PLL1FEED = 0xAA;
+    LPC_SC->PLL1FEED = 0x55;
+#endif
+    LPC_SC->PCONP = PCONP_Val; /* Power Control for Peripherals      */
+
+    LPC_SC->CLKOUTCFG = CLKOUTCFG_Val; /* Clock Output Configuration         */
+#endif
+}
+
+/**
+ * Connect the PLLs
+ *
+ * @param  none
+ * @return none
+ *
+ * @brief  Last boot stage. Sets the flash access time for the target clock,
+ *         waits for PLL lock and connects the PLLs. The vector table offset
+ *         is only set while it still points at flash.
+ */
+void SystemInitFinish(void)
+{
+    const uint32_t PLL0_CONNECT_FLG = (1 << 25) | (1 << 24);
+    const uint32_t PLL1_CONNECT_FLG = (1 << 8) | (1 << 9);
+
+#if (FLASH_SETUP == 1) /* Flash Accelerator Setup            */
+    /* Before raising the clock, so flash is never read too fast */
+    LPC_SC->FLASHCFG = FLASHCFG_Val;
+#endif
+
+#if (CLOCK_SETUP) /* Clock Setup                        */
+#if (PLL0_SETUP)
     while (!(LPC_SC->PLL0STAT & (1 << 26)))
         ; /* Wait for PLOCK0                    */
 
-    LPC_SC->PLL0CON = 0x03; /* PLL0 Enable & Connect              */
+    LPC_SC->CCLKCFG = CCLKCFG_Val; /* Setup Clock Divider                */
+    LPC_SC->PLL0CON = 0x03;        /* PLL0 Enable & Connect              */
     LPC_SC->PLL0FEED = 0xAA;
     LPC_SC->PLL0FEED = 0x55;
     while ((LPC_SC->PLL0STAT & PLL0_CONNECT_FLG) != PLL0_CONNECT_FLG)
         ; /* Wait for PLLC0_STAT & PLLE0_STAT */
+#else
+    LPC_SC->CCLKCFG = CCLKCFG_Val; /* Setup Clock Divider                */
 #endif
 
 #if (PLL1_SETUP)
-    LPC_SC->PLL1CFG = PLL1CFG_Val;
+    while (!(LPC_SC->PLL1STAT & (1 << 10)))
+        ; /* Wait for PLOCK1                    */
+
+    LPC_SC->PLL1CON = 0x03; /* PLL1 Enable & Connect              */
     LPC_SC->PLL1FEED = 0xAA;
     LPC_SC->PLL1FEED = 0x55;
+    while ((LPC_SC->PLL1STAT & PLL1_CONNECT_FLG) != PLL1_CONNECT_FLG)
+        ; /* Wait for PLLC1_STAT & PLLE1_STAT */
+#else
+    LPC_SC->USBCLKCFG = USBCLKCFG_Val; /* Setup USB Clock Divider            */
+#endif
+#endif
 
+//  Set Vector table offset value, unless the table was already moved to
+//  RAM (RAMFUNC_RelocateVectors() before a later SystemInit() call)
+    if (SCB->VTOR < 0x10000000)
+    {
+#if (__RAM_MODE__ == 1)
+        SCB->VTOR = 0x10000000 & 0x3FFFFF80;
+#else
+        SCB->VTOR = 0x00000000 & 0x3FFFFF80;
+#endif
+    }
+}
+
+/**
+ * Restore the clocks after Deep-sleep
+ *
+ * @param  none
+ * @return none
+ *
+ * @brief  Deep-sleep stops the main oscillator and turns the PLLs off, the
+ *         CPU wakes up on the IRC. This waits for the oscillator and
+ *         relocks and reconnects the PLLs with their retained settings.
+ *         Unlike SystemInit(), PCLKSEL and PCONP are left as the
+ *         application set them.
+ */
+void SystemResume(void)
+{
+#if (CLOCK_SETUP) /* Clock Setup                        */
+    const uint32_t PLL0_CONNECT_FLG = (1 << 25) | (1 << 24);
+    const uint32_t PLL1_CONNECT_FLG = (1 << 8) | (1 << 9);
+
+    if (LPC_SC->SCS & (1 << 5))
+    { /* If Main Oscillator is enabled  */
+        while ((LPC_SC->SCS & (1 << 6)) == 0)
+            ; /* Wait for Oscillator to be ready    */
+    }
+
+#if (PLL0_SETUP)
+    LPC_SC->PLL0CON = 0x01; /* PLL0 Enable                        */
+    LPC_SC->PLL0FEED = 0xAA;
+    LPC_SC->PLL0FEED = 0x55;
+    while (!(LPC_SC->PLL0STAT & (1 << 26)))
+        ; /* Wait for PLOCK0                    */
+
+    LPC_SC->PLL0CON = 0x03; /* PLL0 Enable & Connect              */
+    LPC_SC->PLL0FEED = 0xAA;
+    LPC_SC->PLL0FEED = 0x55;
+    while ((LPC_SC->PLL0STAT & PLL0_CONNECT_FLG) != PLL0_CONNECT_FLG)
+        ; /* Wait for PLLC0_STAT & PLLE0_STAT */
+#endif
+
+#if (PLL1_SETUP)
     LPC_SC->PLL1CON = 0x01; /* PLL1 Enable                        */
     LPC_SC->PLL1FEED = 0xAA;
     LPC_SC->PLL1FEED = 0x55;
@@ -549,24 +666,48 @@ void SystemInit(void)
     LPC_SC->PLL1FEED = 0x55;
     while ((LPC_SC->PLL1STAT & PLL1_CONNECT_FLG) != PLL1_CONNECT_FLG)
         ; /* Wait for PLLC1_STAT & PLLE1_STAT */
-#else
-    LPC_SC->USBCLKCFG = USBCLKCFG_Val; /* Setup USB Clock Divider            */
 #endif
-    LPC_SC->PCONP = PCONP_Val; /* Power Control for Peripherals      */
-
-    LPC_SC->CLKOUTCFG = CLKOUTCFG_Val; /* Clock Output Configuration         */
 #endif
+}
 
-#if (FLASH_SETUP == 1) /* Flash Accelerator Setup            */
-    LPC_SC->FLASHCFG = FLASHCFG_Val;
-#endif
+/**
+ * Initialize the system
+ *
+ * @param  none
+ * @return none
+ *
+ * @brief  Setup the microcontroller system.
+ *         Initialize the System. The reset handler already runs the boot
+ *         stages, so when PLL0 is found enabled and connected with the
+ *         configured values (e.g. SystemInit() called again from main)
+ *         the clock setup is skipped instead of being redone.
+ */
+void SystemInit(void)
+{
+#if (CLOCK_SETUP) && (PLL0_SETUP)
+    const uint32_t PLL0_CONNECT_FLG = (1 << 25) | (1 << 24);
 
-//  Set Vector table offset value
-#if (__RAM_MODE__ == 1)
-    SCB->VTOR = 0x10000000 & 0x3FFFFF80;
-#else
-    SCB->VTOR = 0x00000000 & 0x3FFFFF80;
+    if (((LPC_SC->PLL0STAT & PLL0_CONNECT_FLG) == PLL0_CONNECT_FLG) &&
+        ((LPC_SC->PLL0STAT & 0x00FF7FFF) == PLL0CFG_Val) && (LPC_SC->CLKSRCSEL == CLKSRCSEL_Val))
+    {
+        return;
+    }
+
+    /* PLL0 must be disconnected and disabled before it is reconfigured */
+    if (LPC_SC->PLL0STAT & (1 << 25))
+    {
+        LPC_SC->PLL0CON = 0x01;
+        LPC_SC->PLL0FEED = 0xAA;
+        LPC_SC->PLL0FEED = 0x55;
+    }
+    LPC_SC->PLL0CON = 0x00;
+    LPC_SC->PLL0FEED = 0xAA;
+    LPC_SC->PLL0FEED = 0x55;
 #endif
+
+    SystemInitStart();
+    SystemInitPLL();
+    SystemInitFinish();
 }
 
 /**
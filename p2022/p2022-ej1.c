@@ -2,6 +2,7 @@
 #include "lpc17xx_adc.h"
 #include "lpc17xx_pinsel.h"
 #include "lpc17xx_timer.h"
+#include "lpc17xx_section.h"
 
 #define NUM_DATOS 20
 #define ADC_FREQ 100000
@@ -15,7 +16,7 @@ uint8_t indice_canal_4 = 0;  // Índice para el canal 4
 // Prototipos de funciones
 void init_adc(void);
 void init_timer0(void);
-void guardar_datos(uint16_t valor, uint8_t canal);
+SECTION_RAMFUNC void guardar_datos(uint16_t valor, uint8_t canal);
 
 int main(void) {
     SystemInit(); // Inicializar System clk
@@ -92,15 +93,18 @@ void init_timer0(void) {
     NVIC_EnableIRQ(TIMER0_IRQn);
 }
 
-// Manejador de la interrupción del Timer0 (dispara el ADC)
-void TIMER0_IRQHandler(void) {
+// Manejador de la interrupción del Timer0 (dispara el ADC), en RAM: sin esperas de flash.
+// Accede a los registros directamente, las funciones del driver están en flash
+SECTION_RAMFUNC void TIMER0_IRQHandler(void) {
+    uint32_t dato;
+
     // Esperar a que los datos del canal 2 estén listos
-    while (!ADC_ChannelGetStatus(LPC_ADC, ADC_CHANNEL_2, ADC_DATA_DONE));
-    uint16_t valor_canal_2 = ADC_ChannelGetData(LPC_ADC, ADC_CHANNEL_2);
+    while (!((dato = LPC_ADC->ADDR2) & ADC_DR_DONE_FLAG));
+    uint16_t valor_canal_2 = ADC_DR_RESULT(dato);
 
     // Esperar a que los datos del canal 4 estén listos
-    while (!ADC_ChannelGetStatus(LPC_ADC, ADC_CHANNEL_4, ADC_DATA_DONE));
-    uint16_t valor_canal_4 = ADC_ChannelGetData(LPC_ADC, ADC_CHANNEL_4);
+    while (!((dato = LPC_ADC->ADDR4) & ADC_DR_DONE_FLAG));
+    uint16_t valor_canal_4 = ADC_DR_RESULT(dato);
 
     // Guardar los datos del canal 2 en su buffer
     guardar_datos(valor_canal_2, ADC_CHANNEL_2);
@@ -108,12 +112,12 @@ void TIMER0_IRQHandler(void) {
     // Guardar los datos del canal 4 en su buffer
     guardar_datos(valor_canal_4, ADC_CHANNEL_4);
 
-    // Limpiar la interrupción del Timer0
-    TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
+    // Limpiar la interrupción del Match1 del Timer0, el que interrumpe
+    LPC_TIM0->IR = TIM_IR_CLR(1);
 }
 
-// Guardar los datos en los buffers correspondientes
-void guardar_datos(uint16_t valor, uint8_t canal) {
+// Guardar los datos en los buffers correspondientes (en RAM, se llama desde la interrupción)
+SECTION_RAMFUNC void guardar_datos(uint16_t valor, uint8_t canal) {
     if (canal == 2) {
         buffer_canal_2[indice_canal_2] = valor;  // Guardar en el buffer del canal 2
         indice_canal_2++; // Actualizar el índice y resetear si corresponde
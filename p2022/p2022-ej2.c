@@ -1,6 +1,7 @@
 #include "LPC17xx.h"
 #include "lpc17xx_dac.h"
 #include "lpc17xx_timer.h"
+#include "lpc17xx_section.h"
 #include "lpc17xx_pinsel.h"
 
 #define FAST_MODE 0
@@ -84,10 +85,11 @@ void init_timer0(void) {
     NVIC_EnableIRQ(TIMER0_IRQn);
 }
 
-// Manejador de la interrupción del Timer0 (controla el DAC)
-void TIMER0_IRQHandler(void) {
-    // Actualizar el valor del DAC
-    DAC_UpdateValue(LPC_DAC, dac_value);
+// Manejador de la interrupción del Timer0 (controla el DAC), en RAM: sin esperas de flash.
+// Accede a los registros directamente, las funciones del driver están en flash
+SECTION_RAMFUNC void TIMER0_IRQHandler(void) {
+    // Actualizar el valor del DAC, conservando el bit de bias
+    LPC_DAC->DACR = (LPC_DAC->DACR & DAC_BIAS_EN) | DAC_VALUE(dac_value);
 
     // Modificar el valor del DAC según la dirección
     dac_value += direction;
@@ -100,6 +102,6 @@ void TIMER0_IRQHandler(void) {
         direction = 1;  // Cambiar la dirección a subida
     }
 
-    // Limpiar la bandera de interrupción del Timer0
-    TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
+    // Limpiar la bandera de interrupción del Match0 del Timer0
+    LPC_TIM0->IR = TIM_IR_CLR(0);
 }
@@ -4,11 +4,14 @@
 #include "lpc17xx_gpdma.h"
 #include "lpc17xx_timer.h"
 #include "lpc17xx_exti.h"
+#include "lpc17xx_dacwave.h"
+#include "lpc17xx_section.h"
 
 // Definir las direcciones de memoria para AHB SRAM (Bank 0)
 #define BUFFER_SIZE 1024  // Tamaño del buffer circular para ADC y DAC
-uint16_t adc_buffer[BUFFER_SIZE];  // Buffer circular para almacenar muestras ADC
-uint16_t dac_waveform[BUFFER_SIZE];  // Buffer para almacenar la forma de onda triangular
+SECTION_DMA uint16_t adc_buffer[BUFFER_SIZE];  // Buffer circular para almacenar muestras ADC
+// Onda triangular calculada en compilación, en flash y con el formato de DACR
+const uint32_t dac_waveform[BUFFER_SIZE] = { DACWAVE_TABLE(DACWAVE_TRIANGLE, BUFFER_SIZE, 1023, 0, 0) };
 
 // Variables de control
 volatile uint8_t adc_mode = 1;  // 1: Capturando con ADC, 0: Reproduciendo con DAC
@@ -23,9 +26,6 @@ void EINT0_IRQHandler(void);
 int main(void) {
     SystemInit();
 
-    // Generar la onda triangular en el buffer dac_waveform
-    generar_onda_triangular();
-
     // Inicializar ADC con DMA para capturar señales
     init_adc_dma();
 
@@ -83,7 +83,7 @@ void init_dac_dma(void) {
     dmaCfg.SrcMemAddr = (uint32_t)dac_waveform;  // Dirección de origen (forma de onda)
     dmaCfg.DstMemAddr = (uint32_t)&(LPC_DAC->DACR);  // Dirección de destino (DAC)
     dmaCfg.TransferSize = BUFFER_SIZE;  // Tamaño de la transferencia
-    dmaCfg.TransferWidth = GPDMA_WIDTH_HALFWORD;  // Transferencia de 16 bits
+    dmaCfg.TransferWidth = GPDMA_WIDTH_WORD;  // Palabras de DACR, directo de la tabla
     dmaCfg.TransferType = GPDMA_TRANSFERTYPE_M2P;  // Transferencia de memoria a periférico
     dmaCfg.SrcConn = 0;
     dmaCfg.DstConn = GPDMA_CONN_DAC;  // Destino es el DAC
@@ -148,18 +148,3 @@ void EINT0_IRQHandler(void) {
     // Limpiar la interrupción de EINT0
     EXTI_ClearEXTIFlag(EXTI_EINT0);
 }
-
-// Función para inicializar la forma de onda triangular en dac_waveform
-void generar_onda_triangular(void) {
-    uint32_t i;
-
-    // Primera mitad: subida de la señal
-    for (i = 0; i < BUFFER_SIZE / 2; i++) {
-        dac_waveform[i] = (i * 1023) / (BUFFER_SIZE / 2);  // Rango de 0 a 1023
-    }
-
-    // Segunda mitad: bajada de la señal
-    for (i = BUFFER_SIZE / 2; i < BUFFER_SIZE; i++) {
-        dac_waveform[i] = 1023 - ((i - BUFFER_SIZE / 2) * 1023) / (BUFFER_SIZE / 2);  // Rango de 1023 a 0
-    }
-}